@@ -17,6 +17,7 @@
 /// - 0: BLOCK_START
 /// - 1: Before JUMP (appears to be the best option in most cases)
 /// - 2: JUMPDEST
+/// - 3: Where the compiler has placed GAS_CHECK (see below)
 ///
 /// The most natural place to perform the gas check is at the beginning of each
 /// basic block. However, we may also check it before JUMP(I)'s or JUMPDEST's.
@@ -29,6 +30,14 @@
 #define GAS_CHECK_LOC 1
 #endif
 
+/// The gas checks of GAS_CHECK_LOC 3. The compiler checks the gas before every dynamic jump
+/// and every back edge of the control flow graph, so the execution still terminates, and
+/// wherever the base gas used since the last check could exceed a budget, so a large
+/// (straight-line) program cannot run far beyond its gas. All the other checks are elided.
+#define GAS_CHECK                                                           \
+    if (!GAS_CHECK_OFF && (GAS_CHECK_LOC == 3) && (gas < 0)) [[unlikely]]   \
+        goto label_final;
+
 /// "Optimization" 3: turn off the gas check entirely (but leave gas metering).
 /// This is not a plausible optimization on its own because a program may now
 /// run forever. For now, this is only used in performance experiments.
@@ -50,7 +59,7 @@
         goto label_final;
 
 #define INVOKE(Op, ...)                                                                                 \
-    instr::core::impl<OP_##Op>(stack, gas, status, jump_addr, state __VA_OPT__(,) __VA_ARGS__);         \
+    instr::core::impl<OP_##Op, Rev>(stack, gas, status, jump_addr, state __VA_OPT__(,) __VA_ARGS__);    \
     if constexpr (OP_##Op == OP_JUMPDEST) {                                                             \
         if (!GAS_CHECK_OFF && (GAS_CHECK_LOC == 2) && (gas < 0))                                        \
             goto label_final;                                                                           \
@@ -98,11 +107,71 @@
     INVOKE(JUMPI, jumpdest_map)
 #endif
 
-#define PROLOGUE                                                    \
+/// Dynamic JUMP(I)s whose targets the compiler has resolved by tracking the constants on the
+/// stack (e.g. the return addresses of internal functions). A single target is jumped to
+/// directly, like PUSHnJUMP. A few targets are dispatched by a switch of JUMP_CASEs; any other
+/// target (not expected) takes the generic jump.
+#define JUMP_TO(ofs)                                                        \
+    stack.drop(1);                                                          \
+    if (!GAS_CHECK_OFF && (GAS_CHECK_LOC == 1) && (gas < 0)) [[unlikely]]   \
+        goto label_final;                                                   \
+    goto L_OFFSET_##ofs;
+
+#define JUMPI_TO(ofs)                                                       \
+    stack.drop(2);                                                          \
+    if (stack[-1]) {                                                        \
+        if (!GAS_CHECK_OFF && (GAS_CHECK_LOC == 1) && (gas < 0)) [[unlikely]] \
+            goto label_final;                                               \
+        goto L_OFFSET_##ofs;                                                \
+    }
+
+#define JUMP_SWITCH                                                         \
+    stack.drop(1);                                                          \
+    if (!GAS_CHECK_OFF && (GAS_CHECK_LOC == 1) && (gas < 0)) [[unlikely]]   \
+        goto label_final;                                                   \
+    switch (jump_key(stack[-1])) {
+
+#define JUMP_SWITCH_END                                                     \
+    default:                                                                \
+        goto *instr::core::jump_impl(state, stack[-1], jumpdest_map);       \
+    }
+
+#define JUMPI_SWITCH                                                        \
+    stack.drop(2);                                                          \
+    if (stack[-1]) {                                                        \
+        if (!GAS_CHECK_OFF && (GAS_CHECK_LOC == 1) && (gas < 0)) [[unlikely]] \
+            goto label_final;                                               \
+        switch (jump_key(stack[-2])) {
+
+#define JUMPI_SWITCH_END                                                    \
+        default:                                                            \
+            goto *instr::core::jump_impl(state, stack[-2], jumpdest_map);   \
+        }                                                                   \
+    }
+
+#define JUMP_CASE(ofs)                                                      \
+    case ofs:                                                               \
+        goto L_OFFSET_##ofs;
+
+/// Replace PUSHnJUMP(ofs) back to the header of a loop with the copy of the header's code that
+/// follows (loop rotation): perform the gas check of the jump and the requirement checks of
+/// the header block, but stay in place.
+#define LOOP_ROTATE(ofs)                                                                \
+    if (!GAS_CHECK_OFF && (GAS_CHECK_LOC == 1) && (gas < 0)) [[unlikely]]               \
+        goto label_final;                                                               \
+    status = check_block_requirements(bb_##ofs, gas, &stack.top(), stack_bottom);       \
+    if ((!GAS_CHECK_OFF && (GAS_CHECK_LOC == 0) && (gas < 0)) ||                        \
+            status != EVMC_SUCCESS) [[unlikely]]                                        \
+        goto label_final;
+
+/// The contract function starts with PROLOGUE(rev), where rev is the EVM revision the contract
+/// is compiled for: INVOKE calls the instruction implementations specialized for it.
+#define PROLOGUE(REV)                                               \
     _Pragma("GCC diagnostic push")                                  \
     _Pragma("GCC diagnostic ignored \"-Wunused-label\"")            \
     _Pragma("GCC diagnostic ignored \"-Wgnu-label-as-value\"")      \
     using namespace evmone::intx;                                   \
+    [[maybe_unused]] constexpr evmc_revision Rev = REV;             \
     int64_t gas = state.msg->gas;                                   \
     StackTop stack(state.stack_space.bottom());                     \
     auto stack_bottom = &stack.top();                               \
@@ -118,6 +187,72 @@
     return make_result(gas, state);     \
     _Pragma("GCC diagnostic pop")
 
+/// Large contracts are split into regions: functions of the form
+///
+///     void region(ExecutionState& state, RegionContext& region)
+///
+/// generated like a whole contract, except that they start at the block region.next_offset
+/// (looked up in the region_entries map) and that the blocks of the other regions are
+/// replaced by REGION_EXIT stubs. A stub saves the VM state in the RegionContext and
+/// returns; the trampoline (the contract function) then calls the region of the next block.
+#define REGION_PROLOGUE(REV)                                        \
+    _Pragma("GCC diagnostic push")                                  \
+    _Pragma("GCC diagnostic ignored \"-Wunused-label\"")            \
+    _Pragma("GCC diagnostic ignored \"-Wgnu-label-as-value\"")      \
+    using namespace evmone::intx;                                   \
+    [[maybe_unused]] constexpr evmc_revision Rev = REV;             \
+    int64_t gas = region.gas;                                       \
+    StackTop stack(region.stack_top);                               \
+    auto stack_bottom = state.stack_space.bottom();                 \
+    evmc_status_code status = EVMC_SUCCESS;                         \
+    native_jumpdest jump_addr {};                                   \
+    uint64_t next_offset = 0;                                       \
+    state.bad_jump_handler = &&label_final;
+
+#define REGION_ENTER                                                \
+    goto *region_entries.get_jumpdest(region.next_offset);
+
+/// Leave the region to continue at the block of another region.
+#define REGION_EXIT(ofs)                \
+  L_OFFSET_##ofs:                       \
+    next_offset = ofs;                  \
+    goto label_exit;
+
+#define REGION_EPILOGUE                             \
+  label_final:                                      \
+    if (gas < 0)                                    \
+        status = EVMC_OUT_OF_GAS;                   \
+    next_offset = RegionContext::final_offset;      \
+  label_exit:                                       \
+    region.gas = gas;                               \
+    region.stack_top = &stack.top();                \
+    region.status = status;                         \
+    region.next_offset = next_offset;               \
+    return;                                         \
+    _Pragma("GCC diagnostic pop")
+
+/// The trampoline: calls the region containing the next block until the execution ends.
+#define REGION_TRAMPOLINE_BEGIN(ofs)                                                    \
+    RegionContext region{state.msg->gas, state.stack_space.bottom(), EVMC_SUCCESS, ofs}; \
+    while (region.next_offset != RegionContext::final_offset)                           \
+    {                                                                                   \
+        switch (region.next_offset)                                                     \
+        {
+
+#define REGION_CASE(ofs) case ofs:
+
+#define REGION_CALL(fn)                 \
+            fn(state, region);          \
+            break;
+
+#define REGION_TRAMPOLINE_END           \
+        default:                        \
+            __builtin_unreachable();    \
+        }                               \
+    }                                   \
+    state.status = region.status;       \
+    return make_result(region.gas, state);
+
 
 namespace evmone
 {
@@ -135,6 +270,20 @@ struct BasicBlock
     int stack_max_growth {};
 };
 
+/// The VM state passed between the regions of a contract (see REGION_PROLOGUE).
+struct RegionContext
+{
+    /// The next_offset of the finished execution.
+    static constexpr uint64_t final_offset = std::numeric_limits<uint64_t>::max();
+
+    int64_t gas;
+    uint256* stack_top;
+    evmc_status_code status;
+
+    /// The bytecode offset of the block to continue at.
+    uint64_t next_offset;
+};
+
 /// Check if the current VM state satisfies the minimum requirements of executing a basic block.
 inline evmc_status_code
 check_block_requirements(const BasicBlock& basic_block, int64_t& gas_left,
@@ -153,6 +302,13 @@ check_block_requirements(const BasicBlock& basic_block, int64_t& gas_left,
     return EVMC_SUCCESS;
 }
 
+/// Returns the switch key of a jump target: the offset, or a value which is not an offset.
+inline uint64_t jump_key(const uint256& offset) noexcept
+{
+    constexpr auto max = std::numeric_limits<uint64_t>::max();
+    return offset < max ? uint64_t(offset) : max;
+}
+
 /// Prepare the execution result of an EVM transaction.
 inline evmc_result
 make_result(int64_t gas, ExecutionState& state)
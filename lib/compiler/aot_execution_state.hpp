@@ -27,34 +27,42 @@ using bytes_view = std::basic_string_view<uint8_t>;
 /// Jump destination in the native code.
 using native_jumpdest = void*;
 
-/// Map of valid jump destinations.
+class ExecutionState;
+
+/// Entry point of a compiled contract (see compile_cxx()).
+using native_contract = evmc_result (*)(ExecutionState& state);
+
+/// Map of valid jump destinations. The jump targets of a contract are numbered from 1 by
+/// a table indexed directly by the bytecode offset (0 for the other offsets), shared by the
+/// functions of the contract. Every function has its own small table of the labels indexed
+/// by these numbers, holding null for the number 0 and the targets not valid there.
+/// The index ends at the last target, so a lookup is a range check and two loads.
+///
+/// The numbers are uint16_t, or uint32_t for contracts of more than 65535 targets.
+template <typename Index>
 struct JumpdestMap
 {
-    /// The maximum number of jump destinations in a contract.
-    static constexpr auto limit = 1 << 10;
-
-    /// Actual number of jump destinations.
+    /// Number of entries of the index: the last target bytecode offset + 1.
     const size_t size;
 
-    /// Bytecode offsets in ascending order.
-    std::array<uint256, limit> keys;
+    /// The numbers of the targets, indexed by the bytecode offset.
+    const Index* index;
 
-    /// Jump destinations in the compiled contract.
-    std::array<native_jumpdest, limit> vals;
+    /// Jump destinations in the compiled function, indexed by the numbers of the targets.
+    const native_jumpdest* labels;
 
     /// Returns if the target bytecode offset is a legit jump destination.
     /// Only used at compile-time.
     [[nodiscard]] consteval bool is_jumpdest(const uint256& offset) const noexcept
     {
-        return std::binary_search(keys.begin(), keys.begin() + size, offset);
+        return offset < size && labels[index[static_cast<size_t>(offset)]] != nullptr;
     }
 
-    /// Returns the corresponding jump destination of a bytecode offset.
+    /// Returns the corresponding jump destination of a bytecode offset,
+    /// or null if the offset is not a valid jump destination.
     [[nodiscard]] native_jumpdest get_jumpdest(const uint256& offset) const noexcept
     {
-        auto lower = std::lower_bound(keys.begin(), keys.begin() + size, offset);
-        auto index = size_t(lower - keys.begin());
-        return index < size ? vals[index] : native_jumpdest{};
+        return offset < size ? labels[index[static_cast<size_t>(offset)]] : native_jumpdest{};
     }
 };
 
@@ -119,6 +127,7 @@ public:
 
     [[nodiscard]] const uint8_t* data() const noexcept { return m_data; }
     [[nodiscard]] size_t size() const noexcept { return m_size; }
+    [[nodiscard]] size_t capacity() const noexcept { return m_capacity; }
 
     /// Grows the memory to the given size. The extend is filled with zeros.
     ///
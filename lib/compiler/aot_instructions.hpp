@@ -37,6 +37,9 @@ public:
 
     /// Assigns the value to the stack top and moves the stack top pointer up.
     void push(const uint256& value) noexcept { *++m_top = value; }
+
+    /// Moves the stack top pointer down by n items (used by the promoted stack operations).
+    void drop(int n) noexcept { m_top -= n; }
 };
 
 constexpr auto max_buffer_size = std::numeric_limits<uint32_t>::max();
@@ -148,28 +151,28 @@ inline void sub(PARAMS) noexcept
 inline void div(PARAMS) noexcept
 {
     auto& v = stack[1];
-    v = v != 0 ? stack[0] / v : 0;
+    v = v != 0 ? intx::udivrem(stack[0], v).quot : 0;
     std::ignore = stack.pop();
 }
 
 inline void sdiv(PARAMS) noexcept
 {
     auto& v = stack[1];
-    v = v != 0 ? uint256(int256(stack[0]) / int256(v)) : 0;
+    v = v != 0 ? intx::sdivrem(stack[0], v).quot : 0;
     std::ignore = stack.pop();
 }
 
 inline void mod(PARAMS) noexcept
 {
     auto& v = stack[1];
-    v = v != 0 ? stack[0] % v : 0;
+    v = v != 0 ? intx::udivrem(stack[0], v).rem : 0;
     std::ignore = stack.pop();
 }
 
 inline void smod(PARAMS) noexcept
 {
     auto& v = stack[1];
-    v = v != 0 ? uint256(int256(stack[0]) % int256(v)) : 0;
+    v = v != 0 ? intx::sdivrem(stack[0], v).rem : 0;
     std::ignore = stack.pop();
 }
 
@@ -189,6 +192,7 @@ inline void mulmod(PARAMS) noexcept
     m = m != 0 ? intx::mulmod(x, y, m) : 0;
 }
 
+template <evmc_revision Rev>
 inline void exp(PARAMS) noexcept
 {
     const auto& base = stack.pop();
@@ -196,7 +200,7 @@ inline void exp(PARAMS) noexcept
 
     const auto exponent_significant_bytes =
         static_cast<int>(intx::count_significant_bytes(exponent));
-    const auto exponent_cost = state.rev >= EVMC_SPURIOUS_DRAGON ? 50 : 10;
+    constexpr auto exponent_cost = Rev >= EVMC_SPURIOUS_DRAGON ? 50 : 10;
     const auto additional_cost = exponent_significant_bytes * exponent_cost;
     if ((gas_left -= additional_cost) < 0)
         RETURN_STATUS(EVMC_OUT_OF_GAS)
@@ -273,15 +277,20 @@ inline void not_(PARAMS) noexcept
     stack.top() = ~stack.top();
 }
 
-inline void byte(PARAMS) noexcept
+/// Returns the result of BYTE (also used by the promoted stack instructions, see codegen).
+inline uint256 byte_value(const uint256& n, const uint256& x) noexcept
 {
-    const auto& n = stack.pop();
-    auto& x = stack.top();
-
     const bool n_valid = n < 32;
     const uint8_t byte_mask = (n_valid ? 0xff : 0);
     const uint8_t index = 31 - uint8_t(n % 32);
-    x = (x >> index) & byte_mask;
+    return (x >> index) & byte_mask;
+}
+
+inline void byte(PARAMS) noexcept
+{
+    const auto& n = stack.pop();
+    auto& x = stack.top();
+    x = byte_value(n, x);
 }
 
 inline void shl(PARAMS) noexcept
@@ -294,16 +303,21 @@ inline void shr(PARAMS) noexcept
     stack.top() >>= stack.pop();
 }
 
-inline void sar(PARAMS) noexcept
+/// Returns the result of SAR (also used by the promoted stack instructions, see codegen).
+inline uint256 sar_value(const uint256& y, const uint256& x) noexcept
 {
-    const auto& y = stack.pop();
-    auto& x = stack.top();
-
     const bool is_neg = x < 0;
     const auto sign_mask = is_neg ? ~uint256{} : uint256{};
 
     const auto mask_shift = (y < 256) ? (256 - y) : 0;
-    x = (x >> y) | (sign_mask << mask_shift);
+    return (x >> y) | (sign_mask << mask_shift);
+}
+
+inline void sar(PARAMS) noexcept
+{
+    const auto& y = stack.pop();
+    auto& x = stack.top();
+    x = sar_value(y, x);
 }
 
 inline void keccak256(PARAMS) noexcept
@@ -331,12 +345,13 @@ inline void address(PARAMS) noexcept
     stack.push(intx::load_be256(state.msg->recipient));
 }
 
+template <evmc_revision Rev>
 inline void balance(PARAMS) noexcept
 {
     auto& x = stack.top();
     const auto addr = intx::trunc_be<evmc::address>(x);
 
-    if (state.rev >= EVMC_BERLIN && state.host.access_account(addr) == EVMC_ACCESS_COLD)
+    if (Rev >= EVMC_BERLIN && state.host.access_account(addr) == EVMC_ACCESS_COLD)
     {
         if ((gas_left -= instr::additional_cold_account_access_cost) < 0)
             RETURN_STATUS(EVMC_OUT_OF_GAS)
@@ -463,12 +478,13 @@ inline void blobhash(PARAMS) noexcept
                 0;
 }
 
+template <evmc_revision Rev>
 inline void extcodesize(PARAMS) noexcept
 {
     auto& x = stack.top();
     const auto addr = intx::trunc_be<evmc::address>(x);
 
-    if (state.rev >= EVMC_BERLIN && state.host.access_account(addr) == EVMC_ACCESS_COLD)
+    if (Rev >= EVMC_BERLIN && state.host.access_account(addr) == EVMC_ACCESS_COLD)
     {
         if ((gas_left -= instr::additional_cold_account_access_cost) < 0)
             RETURN_STATUS(EVMC_OUT_OF_GAS)
@@ -477,6 +493,7 @@ inline void extcodesize(PARAMS) noexcept
     x = state.host.get_code_size(addr);
 }
 
+template <evmc_revision Rev>
 inline void extcodecopy(PARAMS) noexcept
 {
     const auto addr = intx::trunc_be<evmc::address>(stack.pop());
@@ -491,7 +508,7 @@ inline void extcodecopy(PARAMS) noexcept
     if (const auto cost = copy_cost(s); (gas_left -= cost) < 0) 
         RETURN_STATUS(EVMC_OUT_OF_GAS)
 
-    if (state.rev >= EVMC_BERLIN && state.host.access_account(addr) == EVMC_ACCESS_COLD)
+    if (Rev >= EVMC_BERLIN && state.host.access_account(addr) == EVMC_ACCESS_COLD)
     {
         if ((gas_left -= instr::additional_cold_account_access_cost) < 0) 
             RETURN_STATUS(EVMC_OUT_OF_GAS)
@@ -539,12 +556,13 @@ inline void returndatacopy(PARAMS) noexcept
         std::memcpy(&state.memory[dst], &state.return_data[src], s);
 }
 
+template <evmc_revision Rev>
 inline void extcodehash(PARAMS) noexcept
 {
     auto& x = stack.top();
     const auto addr = intx::trunc_be<evmc::address>(x);
 
-    if (state.rev >= EVMC_BERLIN && state.host.access_account(addr) == EVMC_ACCESS_COLD)
+    if (Rev >= EVMC_BERLIN && state.host.access_account(addr) == EVMC_ACCESS_COLD)
     {
         if ((gas_left -= instr::additional_cold_account_access_cost) < 0)
             RETURN_STATUS(EVMC_OUT_OF_GAS)
@@ -635,8 +653,19 @@ inline void mstore8(PARAMS) noexcept
     state.memory[static_cast<size_t>(index)] = static_cast<uint8_t>(value);
 }
 
+/// Applies the macro to every EVM revision, e.g. to explicitly instantiate
+/// the exported instruction implementations for all revisions.
+#define MAP_REVISIONS(X)                                                                 \
+    X(EVMC_FRONTIER) X(EVMC_HOMESTEAD) X(EVMC_TANGERINE_WHISTLE) X(EVMC_SPURIOUS_DRAGON) \
+    X(EVMC_BYZANTIUM) X(EVMC_CONSTANTINOPLE) X(EVMC_PETERSBURG) X(EVMC_ISTANBUL)         \
+    X(EVMC_BERLIN) X(EVMC_LONDON) X(EVMC_PARIS) X(EVMC_SHANGHAI) X(EVMC_CANCUN)          \
+    X(EVMC_PRAGUE)
+static_assert(EVMC_PRAGUE == EVMC_MAX_REVISION, "MAP_REVISIONS must list all revisions");
+
+template <evmc_revision Rev>
 EVMC_EXPORT void sload(PARAMS) noexcept;
 
+template <evmc_revision Rev>
 EVMC_EXPORT void sstore(PARAMS) noexcept;
 
 inline constexpr auto rjump = unimplemented_op;
@@ -644,7 +673,8 @@ inline constexpr auto rjumpi = unimplemented_op;
 inline constexpr auto rjumpv = unimplemented_op;
 
 /// Internal jump implementation for JUMP/JUMPI instructions.
-inline native_jumpdest jump_impl(ExecutionState& state, const uint256& offset, const JumpdestMap& jumpdest_map) noexcept
+template <typename Index>
+inline native_jumpdest jump_impl(ExecutionState& state, const uint256& offset, const JumpdestMap<Index>& jumpdest_map) noexcept
 {
     const auto dst = jumpdest_map.get_jumpdest(offset);
     if (!dst) {
@@ -654,17 +684,19 @@ inline native_jumpdest jump_impl(ExecutionState& state, const uint256& offset, c
     return dst;
 }
 
-inline void jump(PARAMS, const JumpdestMap& jumpdest_map) noexcept
+/// JUMP and JUMPI are function objects (rather than templates of the index type of the map)
+/// so that they are mapped to their opcodes like the other instructions.
+inline constexpr auto jump = []<typename Index>(PARAMS, const JumpdestMap<Index>& jumpdest_map) noexcept
 {
     jump_addr = jump_impl(state, stack.pop(), jumpdest_map);
-}
+};
 
-inline void jumpi(PARAMS, const JumpdestMap& jumpdest_map) noexcept
+inline constexpr auto jumpi = []<typename Index>(PARAMS, const JumpdestMap<Index>& jumpdest_map) noexcept
 {
     const auto& dst = stack.pop();
     const auto& cond = stack.pop();
     jump_addr = cond ? jump_impl(state, dst, jumpdest_map) : nullptr;
-}
+};
 
 inline void jumpdest(PARAMS) noexcept
 {
@@ -858,17 +890,23 @@ inline void log(PARAMS) noexcept
 }
 
 
-template <Opcode Op>
+template <Opcode Op, evmc_revision Rev>
 EVMC_EXPORT void call_impl(PARAMS) noexcept;
-inline constexpr auto call = call_impl<OP_CALL>;
-inline constexpr auto callcode = call_impl<OP_CALLCODE>;
-inline constexpr auto delegatecall = call_impl<OP_DELEGATECALL>;
-inline constexpr auto staticcall = call_impl<OP_STATICCALL>;
-
-template <Opcode Op>
+template <evmc_revision Rev>
+inline constexpr auto call = call_impl<OP_CALL, Rev>;
+template <evmc_revision Rev>
+inline constexpr auto callcode = call_impl<OP_CALLCODE, Rev>;
+template <evmc_revision Rev>
+inline constexpr auto delegatecall = call_impl<OP_DELEGATECALL, Rev>;
+template <evmc_revision Rev>
+inline constexpr auto staticcall = call_impl<OP_STATICCALL, Rev>;
+
+template <Opcode Op, evmc_revision Rev>
 EVMC_EXPORT void create_impl(PARAMS) noexcept;
-inline constexpr auto create = create_impl<OP_CREATE>;
-inline constexpr auto create2 = create_impl<OP_CREATE2>;
+template <evmc_revision Rev>
+inline constexpr auto create = create_impl<OP_CREATE, Rev>;
+template <evmc_revision Rev>
+inline constexpr auto create2 = create_impl<OP_CREATE2, Rev>;
 inline constexpr auto callf = unimplemented_op;
 inline constexpr auto retf = unimplemented_op;
 
@@ -889,6 +927,7 @@ inline void return_impl(PARAMS) noexcept
 inline constexpr auto return_ = return_impl<EVMC_SUCCESS>;
 inline constexpr auto revert = return_impl<EVMC_REVERT>;
 
+template <evmc_revision Rev>
 inline void selfdestruct(PARAMS) noexcept
 {
     if (state.in_static_mode()) {
@@ -898,7 +937,7 @@ inline void selfdestruct(PARAMS) noexcept
 
     const auto beneficiary = intx::trunc_be<evmc::address>(stack[0]);
 
-    if (state.rev >= EVMC_BERLIN && state.host.access_account(beneficiary) == EVMC_ACCESS_COLD)
+    if (Rev >= EVMC_BERLIN && state.host.access_account(beneficiary) == EVMC_ACCESS_COLD)
     {
         if ((gas_left -= instr::cold_account_access_cost) < 0) {
             status = EVMC_OUT_OF_GAS;
@@ -906,9 +945,9 @@ inline void selfdestruct(PARAMS) noexcept
         }
     }
 
-    if (state.rev >= EVMC_TANGERINE_WHISTLE)
+    if (Rev >= EVMC_TANGERINE_WHISTLE)
     {
-        if (state.rev == EVMC_TANGERINE_WHISTLE || state.host.get_balance(state.msg->recipient))
+        if (Rev == EVMC_TANGERINE_WHISTLE || state.host.get_balance(state.msg->recipient))
         {
             // After TANGERINE_WHISTLE apply additional cost of
             // sending value to a non-existing account.
@@ -924,25 +963,27 @@ inline void selfdestruct(PARAMS) noexcept
 
     if (state.host.selfdestruct(state.msg->recipient, beneficiary))
     {
-        if (state.rev < EVMC_LONDON)
+        if (Rev < EVMC_LONDON)
             state.gas_refund += 24000;
     }
 }
 
 
-/// Maps an opcode to the instruction implementation.
+/// Maps an opcode and the EVM revision to the instruction implementation.
 ///
 /// The set of template specializations which map opcodes `Op` to the function
-/// implementing the instruction identified by the opcode.
-///     instr::impl<OP_DUP1>(/*...*/);
-/// The unspecialized template is invalid and should never to used.
-template <Opcode Op>
+/// implementing the instruction identified by the opcode in the revision `Rev`.
+///     instr::impl<OP_DUP1, EVMC_SHANGHAI>(/*...*/);
+/// The implementations depending on the revision are templates instantiated with `Rev`,
+/// so the compiled contract (compiled for a single revision) does not check the revision
+/// at runtime. The unspecialized template is invalid and should never to used.
+template <Opcode Op, evmc_revision Rev>
 inline constexpr auto impl = nullptr;
 
 #undef ON_OPCODE_IDENTIFIER
 #define ON_OPCODE_IDENTIFIER(OPCODE, IDENTIFIER) \
-    template <>                                  \
-    inline constexpr auto impl<OPCODE> = IDENTIFIER;  // opcode -> implementation
+    template <evmc_revision Rev>                 \
+    inline constexpr auto impl<OPCODE, Rev> = IDENTIFIER;  // opcode -> implementation
 MAP_OPCODES
 #undef ON_OPCODE_IDENTIFIER
 #define ON_OPCODE_IDENTIFIER ON_OPCODE_IDENTIFIER_DEFAULT
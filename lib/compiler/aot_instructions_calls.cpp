@@ -6,7 +6,7 @@
 
 namespace evmone::instr::core
 {
-template <Opcode Op>
+template <Opcode Op, evmc_revision Rev>
 void call_impl(PARAMS) noexcept
 {
     static_assert(
@@ -24,7 +24,7 @@ void call_impl(PARAMS) noexcept
     stack.push(0);  // Assume failure.
     state.return_data.clear();
 
-    if (state.rev >= EVMC_BERLIN && state.host.access_account(dst) == EVMC_ACCESS_COLD)
+    if (Rev >= EVMC_BERLIN && state.host.access_account(dst) == EVMC_ACCESS_COLD)
     {
         if ((gas_left -= instr::additional_cold_account_access_cost) < 0)
             RETURN_STATUS(EVMC_OUT_OF_GAS)
@@ -67,7 +67,7 @@ void call_impl(PARAMS) noexcept
         if (has_value && state.in_static_mode())
             RETURN_STATUS(EVMC_STATIC_MODE_VIOLATION)
 
-        if ((has_value || state.rev < EVMC_SPURIOUS_DRAGON) && !state.host.account_exists(dst))
+        if ((has_value || Rev < EVMC_SPURIOUS_DRAGON) && !state.host.account_exists(dst))
             cost += 25000;
     }
 
@@ -78,7 +78,7 @@ void call_impl(PARAMS) noexcept
     if (int256(gas) < msg.gas)
         msg.gas = static_cast<int64_t>(gas);
 
-    if (state.rev >= EVMC_TANGERINE_WHISTLE)  // TODO: Always true for STATICCALL.
+    if (Rev >= EVMC_TANGERINE_WHISTLE)  // TODO: Always true for STATICCALL.
         msg.gas = std::min(msg.gas, gas_left - gas_left / 64);
     else if (msg.gas > gas_left)
         RETURN_STATUS(EVMC_OUT_OF_GAS)
@@ -97,7 +97,7 @@ void call_impl(PARAMS) noexcept
 
     if constexpr (Op == OP_DELEGATECALL)
     {
-        if (state.rev >= EVMC_PRAGUE && is_eof_container(state.original_code))
+        if (Rev >= EVMC_PRAGUE && is_eof_container(state.original_code))
         {
             // The code targeted by DELEGATECALL must also be an EOF.
             // This restriction has been added to EIP-3540 in
@@ -123,13 +123,16 @@ void call_impl(PARAMS) noexcept
     RETURN_STATUS(EVMC_SUCCESS)
 }
 
-template void call_impl<OP_CALL>(PARAMS) noexcept;
-template void call_impl<OP_STATICCALL>(PARAMS) noexcept;
-template void call_impl<OP_DELEGATECALL>(PARAMS) noexcept;
-template void call_impl<OP_CALLCODE>(PARAMS) noexcept;
+#define INSTANTIATE_CALL_INSTRUCTIONS(REV)                          \
+    template void call_impl<OP_CALL, REV>(PARAMS) noexcept;         \
+    template void call_impl<OP_STATICCALL, REV>(PARAMS) noexcept;   \
+    template void call_impl<OP_DELEGATECALL, REV>(PARAMS) noexcept; \
+    template void call_impl<OP_CALLCODE, REV>(PARAMS) noexcept;
+MAP_REVISIONS(INSTANTIATE_CALL_INSTRUCTIONS)
+#undef INSTANTIATE_CALL_INSTRUCTIONS
 
 
-template <Opcode Op>
+template <Opcode Op, evmc_revision Rev>
 void create_impl(PARAMS) noexcept
 {
     static_assert(Op == OP_CREATE || Op == OP_CREATE2);
@@ -151,10 +154,10 @@ void create_impl(PARAMS) noexcept
     const auto init_code_offset = static_cast<size_t>(init_code_offset_u256);
     const auto init_code_size = static_cast<size_t>(init_code_size_u256);
 
-    if (state.rev >= EVMC_SHANGHAI && init_code_size > 0xC000)
+    if (Rev >= EVMC_SHANGHAI && init_code_size > 0xC000)
         RETURN_STATUS(EVMC_OUT_OF_GAS)
 
-    const auto init_code_word_cost = 6 * (Op == OP_CREATE2) + 2 * (state.rev >= EVMC_SHANGHAI);
+    const auto init_code_word_cost = 6 * (Op == OP_CREATE2) + 2 * (Rev >= EVMC_SHANGHAI);
     const auto init_code_cost = num_words(init_code_size) * init_code_word_cost;
     if ((gas_left -= init_code_cost) < 0)
         RETURN_STATUS(EVMC_OUT_OF_GAS)
@@ -168,7 +171,7 @@ void create_impl(PARAMS) noexcept
 
     auto msg = evmc_message{};
     msg.gas = gas_left;
-    if (state.rev >= EVMC_TANGERINE_WHISTLE)
+    if (Rev >= EVMC_TANGERINE_WHISTLE)
         msg.gas = msg.gas - msg.gas / 64;
 
     msg.kind = (Op == OP_CREATE) ? EVMC_CREATE : EVMC_CREATE2;
@@ -194,6 +197,9 @@ void create_impl(PARAMS) noexcept
     RETURN_STATUS(EVMC_SUCCESS)
 }
 
-template void create_impl<OP_CREATE>(PARAMS) noexcept;
-template void create_impl<OP_CREATE2>(PARAMS) noexcept;
+#define INSTANTIATE_CREATE_INSTRUCTIONS(REV)                    \
+    template void create_impl<OP_CREATE, REV>(PARAMS) noexcept; \
+    template void create_impl<OP_CREATE2, REV>(PARAMS) noexcept;
+MAP_REVISIONS(INSTANTIATE_CREATE_INSTRUCTIONS)
+#undef INSTANTIATE_CREATE_INSTRUCTIONS
 }  // namespace evmone::instr::core
@@ -92,12 +92,13 @@ constexpr auto sstore_costs = []() noexcept {
 }();
 }  // namespace
 
+template <evmc_revision Rev>
 void sload(PARAMS) noexcept
 {
     auto& x = stack.top();
     const auto key = intx::store_be256<evmc::bytes32>(x);
 
-    if (state.rev >= EVMC_BERLIN &&
+    if (Rev >= EVMC_BERLIN &&
         state.host.access_storage(state.msg->recipient, key) == EVMC_ACCESS_COLD)
     {
         // The warm storage access cost is already applied (from the cost table).
@@ -113,29 +114,36 @@ void sload(PARAMS) noexcept
     RETURN_STATUS(EVMC_SUCCESS)
 }
 
+template <evmc_revision Rev>
 void sstore(PARAMS) noexcept
 {
     if (state.in_static_mode())
         RETURN_STATUS(EVMC_STATIC_MODE_VIOLATION)
 
-    if (state.rev >= EVMC_ISTANBUL && gas_left <= 2300)
+    if (Rev >= EVMC_ISTANBUL && gas_left <= 2300)
         RETURN_STATUS(EVMC_OUT_OF_GAS)
 
     const auto key = intx::store_be256<evmc::bytes32>(stack.pop());
     const auto value = intx::store_be256<evmc::bytes32>(stack.pop());
 
     const auto gas_cost_cold =
-        (state.rev >= EVMC_BERLIN &&
+        (Rev >= EVMC_BERLIN &&
             state.host.access_storage(state.msg->recipient, key) == EVMC_ACCESS_COLD) ?
             instr::cold_sload_cost :
             0;
     const auto storage_status = state.host.set_storage(state.msg->recipient, key, value);
 
-    const auto [gas_cost_warm, gas_refund] = sstore_costs[state.rev][storage_status];
+    const auto [gas_cost_warm, gas_refund] = sstore_costs[Rev][storage_status];
     const auto gas_cost = gas_cost_warm + gas_cost_cold;
     if ((gas_left -= gas_cost) < 0)
         RETURN_STATUS(EVMC_OUT_OF_GAS)
     state.gas_refund += gas_refund;
     RETURN_STATUS(EVMC_SUCCESS)
 }
+
+#define INSTANTIATE_STORAGE_INSTRUCTIONS(REV)  \
+    template void sload<REV>(PARAMS) noexcept; \
+    template void sstore<REV>(PARAMS) noexcept;
+MAP_REVISIONS(INSTANTIATE_STORAGE_INSTRUCTIONS)
+#undef INSTANTIATE_STORAGE_INSTRUCTIONS
 }  // namespace evmone::instr::core
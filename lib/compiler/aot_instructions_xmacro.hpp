@@ -29,6 +29,8 @@
 ///    the pairs of all defined opcodes and their matching identifiers.
 ///    This macro is by default alias to ON_OPCODE_IDENTIFIER_DEFAULT therefore users must first
 ///    undef it and restore the alias after usage.
+///    The identifiers of the instructions depending on the EVM revision are templates
+///    instantiated with `Rev`, which must name the revision in the scope of the user.
 ///
 /// See for more about X Macros: https://en.wikipedia.org/wiki/X_Macro.
 #define MAP_OPCODES                                         \
@@ -42,7 +44,7 @@
     ON_OPCODE_IDENTIFIER(OP_SMOD, smod)                     \
     ON_OPCODE_IDENTIFIER(OP_ADDMOD, addmod)                 \
     ON_OPCODE_IDENTIFIER(OP_MULMOD, mulmod)                 \
-    ON_OPCODE_IDENTIFIER(OP_EXP, exp)                       \
+    ON_OPCODE_IDENTIFIER(OP_EXP, exp<Rev>)                  \
     ON_OPCODE_IDENTIFIER(OP_SIGNEXTEND, signextend)         \
     ON_OPCODE_UNDEFINED(0x0c)                               \
     ON_OPCODE_UNDEFINED(0x0d)                               \
@@ -84,7 +86,7 @@
     ON_OPCODE_UNDEFINED(0x2f)                               \
                                                             \
     ON_OPCODE_IDENTIFIER(OP_ADDRESS, address)               \
-    ON_OPCODE_IDENTIFIER(OP_BALANCE, balance)               \
+    ON_OPCODE_IDENTIFIER(OP_BALANCE, balance<Rev>)          \
     ON_OPCODE_IDENTIFIER(OP_ORIGIN, origin)                 \
     ON_OPCODE_IDENTIFIER(OP_CALLER, caller)                 \
     ON_OPCODE_IDENTIFIER(OP_CALLVALUE, callvalue)           \
@@ -94,11 +96,11 @@
     ON_OPCODE_IDENTIFIER(OP_CODESIZE, codesize)             \
     ON_OPCODE_IDENTIFIER(OP_CODECOPY, codecopy)             \
     ON_OPCODE_IDENTIFIER(OP_GASPRICE, gasprice)             \
-    ON_OPCODE_IDENTIFIER(OP_EXTCODESIZE, extcodesize)       \
-    ON_OPCODE_IDENTIFIER(OP_EXTCODECOPY, extcodecopy)       \
+    ON_OPCODE_IDENTIFIER(OP_EXTCODESIZE, extcodesize<Rev>)  \
+    ON_OPCODE_IDENTIFIER(OP_EXTCODECOPY, extcodecopy<Rev>)  \
     ON_OPCODE_IDENTIFIER(OP_RETURNDATASIZE, returndatasize) \
     ON_OPCODE_IDENTIFIER(OP_RETURNDATACOPY, returndatacopy) \
-    ON_OPCODE_IDENTIFIER(OP_EXTCODEHASH, extcodehash)       \
+    ON_OPCODE_IDENTIFIER(OP_EXTCODEHASH, extcodehash<Rev>)  \
                                                             \
     ON_OPCODE_IDENTIFIER(OP_BLOCKHASH, blockhash)           \
     ON_OPCODE_IDENTIFIER(OP_COINBASE, coinbase)             \
@@ -121,8 +123,8 @@
     ON_OPCODE_IDENTIFIER(OP_MLOAD, mload)                   \
     ON_OPCODE_IDENTIFIER(OP_MSTORE, mstore)                 \
     ON_OPCODE_IDENTIFIER(OP_MSTORE8, mstore8)               \
-    ON_OPCODE_IDENTIFIER(OP_SLOAD, sload)                   \
-    ON_OPCODE_IDENTIFIER(OP_SSTORE, sstore)                 \
+    ON_OPCODE_IDENTIFIER(OP_SLOAD, sload<Rev>)              \
+    ON_OPCODE_IDENTIFIER(OP_SSTORE, sstore<Rev>)            \
     ON_OPCODE_IDENTIFIER(OP_JUMP, jump)                     \
     ON_OPCODE_IDENTIFIER(OP_JUMPI, jumpi)                   \
     ON_OPCODE_IDENTIFIER(OP_PC, pc)                         \
@@ -287,19 +289,19 @@
     ON_OPCODE_UNDEFINED(0xee)                               \
     ON_OPCODE_UNDEFINED(0xef)                               \
                                                             \
-    ON_OPCODE_IDENTIFIER(OP_CREATE, create)                 \
-    ON_OPCODE_IDENTIFIER(OP_CALL, call)                     \
-    ON_OPCODE_IDENTIFIER(OP_CALLCODE, callcode)             \
+    ON_OPCODE_IDENTIFIER(OP_CREATE, create<Rev>)            \
+    ON_OPCODE_IDENTIFIER(OP_CALL, call<Rev>)                \
+    ON_OPCODE_IDENTIFIER(OP_CALLCODE, callcode<Rev>)        \
     ON_OPCODE_IDENTIFIER(OP_RETURN, return_)                \
-    ON_OPCODE_IDENTIFIER(OP_DELEGATECALL, delegatecall)     \
-    ON_OPCODE_IDENTIFIER(OP_CREATE2, create2)               \
+    ON_OPCODE_IDENTIFIER(OP_DELEGATECALL, delegatecall<Rev>) \
+    ON_OPCODE_IDENTIFIER(OP_CREATE2, create2<Rev>)          \
     ON_OPCODE_UNDEFINED(0xf6)                               \
     ON_OPCODE_UNDEFINED(0xf7)                               \
     ON_OPCODE_UNDEFINED(0xf8)                               \
     ON_OPCODE_UNDEFINED(0xf9)                               \
-    ON_OPCODE_IDENTIFIER(OP_STATICCALL, staticcall)         \
+    ON_OPCODE_IDENTIFIER(OP_STATICCALL, staticcall<Rev>)    \
     ON_OPCODE_UNDEFINED(0xfb)                               \
     ON_OPCODE_UNDEFINED(0xfc)                               \
     ON_OPCODE_IDENTIFIER(OP_REVERT, revert)                 \
     ON_OPCODE_IDENTIFIER(OP_INVALID, invalid)               \
-    ON_OPCODE_IDENTIFIER(OP_SELFDESTRUCT, selfdestruct)
+    ON_OPCODE_IDENTIFIER(OP_SELFDESTRUCT, selfdestruct<Rev>)
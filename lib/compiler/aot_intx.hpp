@@ -3,7 +3,11 @@
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <bit>
+#include <tuple>
+#include <utility>
 #include "aot_execution_state.hpp"
 
 namespace evmone::intx
@@ -153,15 +157,374 @@ inline T trunc_be(const uint256& x) noexcept
     return r;
 }
 
+/// The division kernels operating on the 64-bit words of the integers (least significant first).
+///
+/// The generic _BitInt division is lowered to a bit-by-bit runtime routine (__udivei4).
+/// These kernels divide word by word instead, with the quotient words estimated using
+/// the reciprocal of the normalized divisor ("Improved division by invariant integers",
+/// Möller & Granlund), as intx does.
+namespace internal
+{
+/// Returns the 128-bit product of two 64-bit words.
+inline constexpr uint128 umul(uint64_t x, uint64_t y) noexcept
+{
+    return uint128{x} * y;
+}
+
+/// The table of the initial approximations of the reciprocals, used by reciprocal_2by1().
+inline constexpr auto reciprocal_table = [] {
+    std::array<uint16_t, 256> table{};
+    for (size_t d9 = 0; d9 < table.size(); ++d9)
+        table[d9] = uint16_t(0x7fd00 / (0x100 | d9));
+    return table;
+}();
+
+/// Computes the reciprocal floor((2^128 - 1) / d) - 2^64 of the normalized word d.
+inline constexpr uint64_t reciprocal_2by1(uint64_t d) noexcept
+{
+    assert((d >> 63) != 0);  // Must be normalized.
+
+    const uint64_t d9 = d >> 55;
+    const uint32_t v0 = reciprocal_table[d9 - 256];
+
+    const uint64_t d40 = (d >> 24) + 1;
+    const uint64_t v1 = (v0 << 11) - uint32_t(uint32_t{v0 * v0} * d40 >> 40) - 1;
+
+    const uint64_t v2 = (v1 << 13) + (v1 * (0x1000000000000000 - v1 * d40) >> 47);
+
+    const uint64_t d0 = d & 1;
+    const uint64_t d63 = (d >> 1) + d0;  // ceil(d / 2)
+    const uint64_t e = ((v2 >> 1) & (0 - d0)) - v2 * d63;
+    const uint64_t v3 = uint64_t(umul(v2, e) >> 64 >> 1) + (v2 << 31);
+
+    return v3 - uint64_t((umul(v3, d) + d) >> 64) - d;
+}
+
+/// Computes the reciprocal floor((2^192 - 1) / d) - 2^64 of the normalized 128-bit d.
+inline constexpr uint64_t reciprocal_3by2(uint128 d) noexcept
+{
+    const auto d1 = uint64_t(d >> 64);
+    const auto d0 = uint64_t(d);
+    auto v = reciprocal_2by1(d1);
+    auto p = d1 * v;
+    p += d0;
+    if (p < d0)
+    {
+        --v;
+        if (p >= d1)
+        {
+            --v;
+            p -= d1;
+        }
+        p -= d1;
+    }
+
+    const auto t = umul(v, d0);
+    const auto t1 = uint64_t(t >> 64);
+    const auto t0 = uint64_t(t);
+    p += t1;
+    if (p < t1)
+    {
+        --v;
+        if (p >= d1 && (p > d1 || t0 >= d0))
+            --v;
+    }
+    return v;
+}
+
+/// Divides the 128-bit u by the normalized word d with the reciprocal v, where u / d < 2^64.
+/// Returns the quotient and the remainder.
+inline constexpr std::pair<uint64_t, uint64_t> udivrem_2by1(
+    uint128 u, uint64_t d, uint64_t v) noexcept
+{
+    const auto q = umul(v, uint64_t(u >> 64)) + u;
+    auto q1 = uint64_t(q >> 64) + 1;
+    auto r = uint64_t(u) - q1 * d;
+    if (r > uint64_t(q))
+    {
+        --q1;
+        r += d;
+    }
+    if (r >= d) [[unlikely]]
+    {
+        ++q1;
+        r -= d;
+    }
+    return {q1, r};
+}
+
+/// Divides the 192-bit (u2, u1, u0) by the normalized 128-bit d with the reciprocal v,
+/// where (u2, u1) < d. Returns the quotient and the remainder.
+inline constexpr std::pair<uint64_t, uint128> udivrem_3by2(
+    uint64_t u2, uint64_t u1, uint64_t u0, uint128 d, uint64_t v) noexcept
+{
+    const auto q = umul(v, u2) + ((uint128{u2} << 64) | u1);
+    auto q1 = uint64_t(q >> 64);
+    const auto r1 = u1 - q1 * uint64_t(d >> 64);
+    auto r = ((uint128{r1} << 64) | u0) - umul(uint64_t(d), q1) - d;
+    ++q1;
+    if (uint64_t(r >> 64) >= uint64_t(q))
+    {
+        --q1;
+        r += d;
+    }
+    if (r >= d) [[unlikely]]
+    {
+        ++q1;
+        r -= d;
+    }
+    return {q1, r};
+}
+
+/// Computes r = x - y * multiplier for the len words. Returns the borrow word.
+inline uint64_t submul(
+    uint64_t r[], const uint64_t x[], const uint64_t y[], int len, uint64_t multiplier) noexcept
+{
+    uint64_t borrow = 0;
+    for (int i = 0; i < len; ++i)
+    {
+        const auto s = x[i] - borrow;
+        const auto p = umul(y[i], multiplier);
+        borrow = uint64_t(p >> 64) + (x[i] < s);
+        r[i] = s - uint64_t(p);
+        borrow += (s < r[i]);
+    }
+    return borrow;
+}
+
+/// Computes r = x + y for the len words. Returns the carry.
+inline bool add(uint64_t r[], const uint64_t x[], const uint64_t y[], int len) noexcept
+{
+    bool carry = false;
+    for (int i = 0; i < len; ++i)
+    {
+        const auto s = x[i] + y[i];
+        const auto c = s < x[i];
+        r[i] = s + carry;
+        carry = c || (r[i] < s);
+    }
+    return carry;
+}
+
+/// Divides the normalized numerator u (ulen words) by the normalized divisor d (dlen >= 3 words)
+/// with the Knuth's algorithm D, where the top word of u is less than the top word of d.
+/// Stores the quotient in q (ulen - dlen words) and the remainder in the dlen bottom words of u.
+inline void udivrem_knuth(
+    uint64_t q[], uint64_t u[], int ulen, const uint64_t d[], int dlen) noexcept
+{
+    const auto divisor = (uint128{d[dlen - 1]} << 64) | d[dlen - 2];
+    const auto reciprocal = reciprocal_3by2(divisor);
+    for (int j = ulen - dlen - 1; j >= 0; --j)
+    {
+        const auto u2 = u[j + dlen];
+        const auto u1 = u[j + dlen - 1];
+        const auto u0 = u[j + dlen - 2];
+
+        uint64_t qhat = 0;
+        if (((uint128{u2} << 64) | u1) == divisor) [[unlikely]]  // The estimate overflows.
+        {
+            qhat = ~uint64_t{0};
+            u[j + dlen] = u2 - submul(&u[j], &u[j], d, dlen, qhat);
+        }
+        else
+        {
+            const auto [qe, rhat] = udivrem_3by2(u2, u1, u0, divisor, reciprocal);
+            qhat = qe;
+            const auto overflow = submul(&u[j], &u[j], d, dlen - 2, qhat);
+            const auto r0 = uint64_t(rhat);
+            const auto r1 = uint64_t(rhat >> 64);
+            u[j + dlen - 2] = r0 - overflow;
+            const bool borrow0 = r0 < overflow;
+            u[j + dlen - 1] = r1 - borrow0;
+            const bool borrow1 = r1 < uint64_t{borrow0};
+
+            if (borrow1)  // The estimate was one too big: add the divisor back.
+            {
+                --qhat;
+                u[j + dlen - 1] += d[dlen - 1] + add(&u[j], &u[j], d, dlen - 1);
+            }
+        }
+        q[j] = qhat;
+    }
+}
+
+/// The quotient and the remainder of the division of the M-word numerator by the N-word divisor.
+template <size_t M, size_t N>
+struct WordsDivResult
+{
+    std::array<uint64_t, M> quot;
+    std::array<uint64_t, N> rem;
+};
+
+/// Divides the M-word u by the N-word d != 0.
+///
+/// Only the significant words take part in the division, so the small operands are cheap:
+/// the divisors of one or two words are handled by the specialized loops of 2-by-1
+/// and 3-by-2 word divisions.
+template <size_t M, size_t N>
+inline WordsDivResult<M, N> udivrem(
+    const std::array<uint64_t, M>& u, const std::array<uint64_t, N>& d) noexcept
+{
+    int dlen = int{N};
+    while (d[size_t(dlen - 1)] == 0)
+        --dlen;
+    int ulen = int{M};
+    while (ulen > 0 && u[size_t(ulen - 1)] == 0)
+        --ulen;
+
+    WordsDivResult<M, N> res{};
+    if (ulen < dlen)
+    {
+        std::copy_n(u.begin(), ulen, res.rem.begin());
+        return res;
+    }
+
+    // Normalize: shift the divisor so that its top bit is set, and the numerator alike.
+    const auto shift = std::countl_zero(d[size_t(dlen - 1)]);
+    const auto shr = [shift](uint64_t hi, uint64_t lo) noexcept {
+        return shift == 0 ? lo : (lo >> shift) | (hi << (64 - shift));
+    };
+    const auto shl = [shift](uint64_t hi, uint64_t lo) noexcept {
+        return shift == 0 ? hi : (hi << shift) | (lo >> (64 - shift));
+    };
+    std::array<uint64_t, N> dn{};
+    for (int i = dlen - 1; i > 0; --i)
+        dn[size_t(i)] = shl(d[size_t(i)], d[size_t(i - 1)]);
+    dn[0] = d[0] << shift;
+    std::array<uint64_t, M + 1> un{};
+    un[size_t(ulen)] = shl(0, u[size_t(ulen - 1)]);
+    for (int i = ulen - 1; i > 0; --i)
+        un[size_t(i)] = shl(u[size_t(i)], u[size_t(i - 1)]);
+    un[0] = u[0] << shift;
+
+    // Include the overflow word of the normalized numerator if needed
+    // so that the top words are less than the divisor.
+    int len = ulen;
+    if (un[size_t(ulen)] != 0 || un[size_t(ulen - 1)] >= dn[size_t(dlen - 1)])
+        ++len;
+
+    if (dlen == 1)
+    {
+        const auto v = reciprocal_2by1(dn[0]);
+        auto r = un[size_t(len - 1)];
+        for (int i = len - 2; i >= 0; --i)
+            std::tie(res.quot[size_t(i)], r) =
+                udivrem_2by1((uint128{r} << 64) | un[size_t(i)], dn[0], v);
+        res.rem[0] = r >> shift;
+    }
+    else if (dlen == 2)
+    {
+        const auto divisor = (uint128{dn[1]} << 64) | dn[0];
+        const auto v = reciprocal_3by2(divisor);
+        auto r = (uint128{un[size_t(len - 1)]} << 64) | un[size_t(len - 2)];
+        for (int i = len - 3; i >= 0; --i)
+            std::tie(res.quot[size_t(i)], r) =
+                udivrem_3by2(uint64_t(r >> 64), uint64_t(r), un[size_t(i)], divisor, v);
+        r >>= shift;
+        res.rem[0] = uint64_t(r);
+        res.rem[1] = uint64_t(r >> 64);
+    }
+    else
+    {
+        udivrem_knuth(res.quot.data(), un.data(), len, dn.data(), dlen);
+        for (int i = 0; i < dlen - 1; ++i)
+            res.rem[size_t(i)] = shr(un[size_t(i + 1)], un[size_t(i)]);
+        res.rem[size_t(dlen - 1)] = un[size_t(dlen - 1)] >> shift;
+    }
+    return res;
+}
+
+/// Returns the 512-bit product of the 256-bit x and y.
+inline std::array<uint64_t, 8> umul(
+    const std::array<uint64_t, 4>& x, const std::array<uint64_t, 4>& y) noexcept
+{
+    std::array<uint64_t, 8> p{};
+    for (size_t j = 0; j < 4; ++j)
+    {
+        uint64_t k = 0;
+        for (size_t i = 0; i < 4; ++i)
+        {
+            const auto t = umul(x[i], y[j]) + p[i + j] + k;
+            p[i + j] = uint64_t(t);
+            k = uint64_t(t >> 64);
+        }
+        p[j + 4] = k;
+    }
+    return p;
+}
+}  // namespace internal
+
+/// Returns the 64-bit words of a uint256 value, the least significant first.
+inline std::array<uint64_t, 4> to_words(const uint256& x) noexcept
+{
+    return {uint64_t(x), uint64_t(x >> 64), uint64_t(x >> 128), uint64_t(x >> 192)};
+}
+
+/// Returns the uint256 value of the 64-bit words, the least significant first.
+inline uint256 from_words(const std::array<uint64_t, 4>& words) noexcept
+{
+    return uint256{words[0]} | uint256{words[1]} << 64 | uint256{words[2]} << 128 |
+           uint256{words[3]} << 192;
+}
+
+template <typename UintT>
+struct div_result
+{
+    UintT quot;
+    UintT rem;
+};
+
+/// Returns the quotient and the remainder of the unsigned division x / y, y != 0.
+inline div_result<uint256> udivrem(const uint256& x, const uint256& y) noexcept
+{
+    if (x < y)
+        return {0, x};
+    if ((x >> 128) == 0)  // Both fit in 128 bits: the native 128-bit division is fast.
+        return {uint128(x) / uint128(y), uint128(x) % uint128(y)};
+
+    const auto r = internal::udivrem(to_words(x), to_words(y));
+    return {from_words(r.quot), from_words(r.rem)};
+}
+
+/// Returns the quotient and the remainder of the signed division x / y, y != 0
+/// (the remainder has the sign of x). The quotient of -2^255 / -1 overflows to -2^255.
+inline div_result<uint256> sdivrem(const uint256& x, const uint256& y) noexcept
+{
+    const auto x_neg = (x >> 255) != 0;
+    const auto y_neg = (y >> 255) != 0;
+    const auto r = udivrem(x_neg ? -x : x, y_neg ? -y : y);
+    return {x_neg != y_neg ? -r.quot : r.quot, x_neg ? -r.rem : r.rem};
+}
+
 inline uint256 addmod(const uint256& x, const uint256& y, const uint256& mod) noexcept
 {
-    // FIXME: implement the fast path of intx::addmod?
-    return (uint257(x) + y) % mod;
+    // Fast path for mod >= 2^192, with x and y at most slightly bigger than mod:
+    // then x, y < 2 * mod, so they are reduced by a single subtraction, and so is their sum.
+    if (const auto m3 = uint64_t(mod >> 192);
+        m3 != 0 && uint64_t(x >> 192) <= m3 && uint64_t(y >> 192) <= m3)
+    {
+        const auto xm = x >= mod ? x - mod : x;
+        const auto ym = y >= mod ? y - mod : y;
+        const auto s = xm + ym;
+        return (s < xm || s >= mod) ? s - mod : s;
+    }
+
+    // The 257-bit sum in 5 words.
+    const auto xw = to_words(x);
+    const auto yw = to_words(y);
+    std::array<uint64_t, 5> s{};
+    s[4] = internal::add(s.data(), xw.data(), yw.data(), 4);
+    return from_words(internal::udivrem(s, to_words(mod)).rem);
 }
 
 inline uint256 mulmod(const uint256& x, const uint256& y, const uint256& mod) noexcept
 {
-    return (uint512(x) * y) % mod;
+    // Fast path for the operands fitting in 128 bits: the product fits in 256 bits.
+    if (((x | y) >> 128) == 0)
+        return udivrem(uint256{uint128(x)} * uint128(y), mod).rem;
+
+    const auto product = internal::umul(to_words(x), to_words(y));
+    return from_words(internal::udivrem(product, to_words(mod)).rem);
 }
 
 inline constexpr uint256 exp(uint256 base, uint256 exponent) noexcept
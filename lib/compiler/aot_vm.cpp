@@ -0,0 +1,248 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+/// @file
+/// EVMC instance (class AotVM) dispatching to compiled contracts is defined here.
+
+#include "aot_vm.hpp"
+#include <evmone/evmone.h>
+#include <evmone/state_pool.hpp>
+#include <algorithm>
+#include <cassert>
+#include <charconv>
+
+namespace evmone
+{
+namespace
+{
+bool parse_uint(std::string_view value, uint64_t& out) noexcept
+{
+    const auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), out);
+    return ec == std::errc{} && end == value.data() + value.size();
+}
+
+/// The per-thread pool of the execution states of the native calls
+/// (compiler-rt has its own ExecutionState).
+using NativeStatePool = StatePool<ExecutionState>;
+
+void destroy(evmc_vm* vm) noexcept
+{
+    assert(vm != nullptr);
+    delete static_cast<AotVM*>(vm);
+}
+
+constexpr evmc_capabilities_flagset get_capabilities(evmc_vm* /*vm*/) noexcept
+{
+    return EVMC_CAPABILITY_EVM1;
+}
+
+evmc_set_option_result set_option(evmc_vm* c_vm, char const* c_name, char const* c_value) noexcept
+{
+    const auto name = (c_name != nullptr) ? std::string_view{c_name} : std::string_view{};
+    const auto value = (c_value != nullptr) ? std::string_view{c_value} : std::string_view{};
+    auto& vm = *static_cast<AotVM*>(c_vm);
+
+    if (name == "registry")
+    {
+        return vm.registry.load(value) ? EVMC_SET_OPTION_SUCCESS : EVMC_SET_OPTION_INVALID_VALUE;
+    }
+    else if (name == "cache")
+    {
+        vm.cache = CodeCache::open(value, vm.cache_budget);
+        return vm.cache ? EVMC_SET_OPTION_SUCCESS : EVMC_SET_OPTION_INVALID_VALUE;
+    }
+    else if (name == "cache-budget")
+    {
+        uint64_t mib = 0;
+        if (!parse_uint(value, mib))
+            return EVMC_SET_OPTION_INVALID_VALUE;
+        vm.cache_budget = mib << 20;
+        return EVMC_SET_OPTION_SUCCESS;
+    }
+    else if (name == "tier-calls")
+    {
+        return parse_uint(value, vm.profiler.thresholds.num_calls) ?
+                   EVMC_SET_OPTION_SUCCESS :
+                   EVMC_SET_OPTION_INVALID_VALUE;
+    }
+    else if (name == "tier-gas")
+    {
+        return parse_uint(value, vm.profiler.thresholds.gas_used) ?
+                   EVMC_SET_OPTION_SUCCESS :
+                   EVMC_SET_OPTION_INVALID_VALUE;
+    }
+    else if (name == "tier-contracts")
+    {
+        uint64_t n = 0;
+        if (!parse_uint(value, n) || n == 0)
+            return EVMC_SET_OPTION_INVALID_VALUE;
+        vm.profiler.max_contracts = size_t(n);
+        return EVMC_SET_OPTION_SUCCESS;
+    }
+    else if (name == "compile-threads")
+    {
+        uint64_t n = 0;
+        if (!parse_uint(value, n) || n == 0 || n > 256)
+            return EVMC_SET_OPTION_INVALID_VALUE;
+        vm.num_compile_threads = unsigned(n);
+        return EVMC_SET_OPTION_SUCCESS;
+    }
+    else if (name == "compile-queue")
+    {
+        uint64_t n = 0;
+        if (!parse_uint(value, n))
+            return EVMC_SET_OPTION_INVALID_VALUE;
+        vm.max_pending_compilations = size_t(n);
+        return EVMC_SET_OPTION_SUCCESS;
+    }
+    return vm.fallback->set_option(vm.fallback, c_name, c_value);
+}
+
+evmc_result execute(evmc_vm* c_vm, const evmc_host_interface* host, evmc_host_context* ctx,
+    evmc_revision rev, const evmc_message* msg, const uint8_t* code, size_t code_size) noexcept
+{
+    auto& vm = *static_cast<AotVM*>(c_vm);
+
+    // Contract creation executes the initcode which has no code hash in the state.
+    if (msg->kind == EVMC_CREATE || msg->kind == EVMC_CREATE2 || !vm.active())
+    {
+        vm.num_fallback_calls.fetch_add(1, std::memory_order_relaxed);
+        return vm.fallback->execute(vm.fallback, host, ctx, rev, msg, code, code_size);
+    }
+
+    // Hashing the code for every call would cost more than most executions.
+    // The Host keeps the code hashes of the accounts so ask it instead.
+    const auto code_hash = host->get_code_hash(ctx, &msg->code_address);
+    if (const auto fn = vm.find(code_hash, rev); fn != nullptr)
+    {
+        NativeStatePool::Handle state;
+        try
+        {
+            state = NativeStatePool::local().acquire(
+                *msg, rev, *host, ctx, bytes_view{code, code_size});
+        }
+        catch (...)
+        {
+            // Out of memory: leave the call to the interpreter.
+        }
+        if (state != nullptr)
+        {
+            vm.num_native_calls.fetch_add(1, std::memory_order_relaxed);
+            return fn(*state);
+        }
+    }
+
+    vm.num_fallback_calls.fetch_add(1, std::memory_order_relaxed);
+    const auto result = vm.fallback->execute(vm.fallback, host, ctx, rev, msg, code, code_size);
+    if (vm.tiering())
+    {
+        // The profiling and the compilation are best effort: on failure (e.g. out of memory
+        // or no thread for the CompileService) the contract is just interpreted.
+        // A contract left hot but not submitted is demoted by its next execution.
+        try
+        {
+            const auto gas_used = uint64_t(msg->gas - std::max(result.gas_left, int64_t{0}));
+            const auto counters = vm.profiler.record(code_hash, rev, gas_used);
+            const auto priority = counters->gas_used.load(std::memory_order_relaxed);
+            if (vm.profiler.promote(*counters))
+                vm.compiler().submit({code_hash, rev}, {code, code_size}, priority);
+            else if (counters->hot.load(std::memory_order_relaxed))
+            {
+                // Still interpreted: the compilation is pending, or it has been dropped
+                // (e.g. by a full queue) or cancelled, or it has failed. A dropped or cancelled
+                // one is counted again for another try, a failed one stays hot and interpreted.
+                const ContractKey key{code_hash, rev};
+                auto* const compiler = vm.started_compiler();
+                if (compiler == nullptr ||
+                    (!compiler->raise_priority(key, priority) && !compiler->failed(key)))
+                    HotnessProfiler::demote(*counters);
+            }
+        }
+        catch (...)
+        {}
+    }
+    return result;
+}
+}  // namespace
+
+
+AotVM::AotVM() noexcept
+  : evmc_vm{
+        EVMC_ABI_VERSION,
+        "evmone-aot",
+        PROJECT_VERSION,
+        evmone::destroy,
+        evmone::execute,
+        evmone::get_capabilities,
+        evmone::set_option,
+    },
+    fallback{evmc_create_evmone()}
+{}
+
+AotVM::~AotVM() noexcept
+{
+    m_compiler.reset();
+    fallback->destroy(fallback);
+}
+
+bool AotVM::active() const noexcept
+{
+    return cache || registry.size() != 0;
+}
+
+native_contract AotVM::find(const evmc::bytes32& code_hash, evmc_revision rev) noexcept
+{
+    if (const auto fn = registry.find(code_hash, rev); fn != nullptr)
+        return fn;
+
+    if (!cache)
+        return nullptr;
+
+    // The misses are recorded until the cache changes: the calls of the interpreted contracts
+    // do not take the locks of the cache.
+    const auto generation = cache->generation();
+    if (registry.missing(code_hash, rev, generation))
+        return nullptr;
+    if (const auto fn = cache->find({code_hash, rev, cache_options}); fn != nullptr)
+    {
+        try
+        {
+            registry.add(code_hash, rev, fn);
+        }
+        catch (...)
+        {}
+        return fn;
+    }
+    try
+    {
+        registry.add_missing(code_hash, rev, generation);
+    }
+    catch (...)
+    {
+        // Out of memory: the miss is not recorded.
+    }
+    return nullptr;
+}
+
+CompileService& AotVM::compiler()
+{
+    std::call_once(m_compiler_once, [this] {
+        m_compiler = std::make_unique<CompileService>(*cache, cache_options, num_compile_threads,
+            max_pending_compilations, [this](const ContractKey& key, native_contract fn) {
+                registry.add(key.code_hash, key.rev, fn);
+                profiler.remove(key.code_hash, key.rev);
+                num_promotions.fetch_add(1, std::memory_order_relaxed);
+            });
+        m_compiler_started.store(true, std::memory_order_release);
+    });
+    return *m_compiler;
+}
+}  // namespace evmone
+
+extern "C" {
+EVMC_EXPORT evmc_vm* evmc_create_evmone_aot() noexcept
+{
+    return new evmone::AotVM{};
+}
+}
@@ -0,0 +1,105 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "compile_service.hpp"
+#include "profiler.hpp"
+#include <atomic>
+#include <mutex>
+
+namespace evmone
+{
+/// The EVMC VM executing compiled contracts natively.
+///
+/// A contract is looked up by the code hash (as reported by the Host) and the revision,
+/// first in the registry, then in the optional compiled code cache. Contracts without native
+/// code (and all contract creations) are executed by the evmone Baseline interpreter.
+///
+/// With tiered execution enabled the interpreted contracts are profiled, and a contract
+/// crossing a hotness threshold is compiled into the cache by a CompileService in the background,
+/// the contracts using more gas first. Once built, it is added to the registry and the following
+/// calls execute the native code.
+///
+/// Options (set before the first execution):
+/// - "registry": path to a shared library with a table of compiled contracts,
+/// - "cache": path to a CodeCache directory,
+/// - "cache-budget": size budget of the CodeCache in MiB (set before "cache"),
+/// - "tier-calls": compile contracts after this number of executions (requires "cache"),
+/// - "tier-gas": compile contracts after this cumulative gas used (requires "cache"),
+/// - "tier-contracts": the maximum number of the profiled contracts (default: 65536),
+/// - "compile-threads": the number of the compilation workers (default: 1),
+/// - "compile-queue": the maximum number of pending compilations (default: 256),
+/// - all other options are forwarded to the interpreter.
+class AotVM : public evmc_vm
+{
+public:
+    /// The compiled contracts available to this VM.
+    ContractRegistry registry;
+
+    /// The persistent cache consulted on registry misses.
+    std::unique_ptr<CodeCache> cache;
+
+    /// The options the contracts in the cache must have been compiled with.
+    CompileOptions cache_options;
+
+    /// The size budget of the cache in bytes.
+    uint64_t cache_budget = uint64_t{1} << 30;
+
+    /// The interpreter executing contracts without native code.
+    evmc_vm* const fallback;
+
+    /// The execution counters of the interpreted contracts (tiered execution).
+    HotnessProfiler profiler;
+
+    /// The configuration of the CompileService.
+    /// @{
+    unsigned num_compile_threads = 1;
+    size_t max_pending_compilations = 256;
+    /// @}
+
+    /// Execution statistics.
+    /// @{
+    std::atomic<uint64_t> num_native_calls = 0;
+    std::atomic<uint64_t> num_fallback_calls = 0;
+    std::atomic<uint64_t> num_promotions = 0;
+    /// @}
+
+    AotVM() noexcept;
+    ~AotVM() noexcept;
+
+    AotVM(const AotVM&) = delete;
+    AotVM& operator=(const AotVM&) = delete;
+
+    /// Returns true if any contract may have native code or be profiled.
+    [[nodiscard]] bool active() const noexcept;
+
+    /// Returns true if the interpreted contracts are profiled.
+    [[nodiscard]] bool tiering() const noexcept { return cache && profiler.thresholds.enabled(); }
+
+    /// Returns the native code of the contract or nullptr.
+    native_contract find(const evmc::bytes32& code_hash, evmc_revision rev) noexcept;
+
+    /// Returns the CompileService building the hot contracts into the cache.
+    /// It is started on first use and requires the cache.
+    CompileService& compiler();
+
+    /// Returns the started CompileService or nullptr.
+    [[nodiscard]] CompileService* started_compiler() const noexcept
+    {
+        return m_compiler_started.load(std::memory_order_acquire) ? m_compiler.get() : nullptr;
+    }
+
+private:
+    std::once_flag m_compiler_once;
+    std::atomic<bool> m_compiler_started = false;
+
+    /// The last member: the workers are stopped before the registry and the cache are destroyed.
+    std::unique_ptr<CompileService> m_compiler;
+};
+}  // namespace evmone
+
+extern "C" {
+/// Creates the evmone VM executing compiled contracts natively.
+EVMC_EXPORT evmc_vm* evmc_create_evmone_aot() noexcept;
+}
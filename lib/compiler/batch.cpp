@@ -0,0 +1,290 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "batch.hpp"
+#include "cache.hpp"
+#include <evmc/hex.hpp>
+#include <ethash/keccak.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <thread>
+#include <unordered_set>
+
+namespace evmone
+{
+namespace fs = std::filesystem;
+
+namespace
+{
+void set_error(std::string* error, std::string message)
+{
+    if (error != nullptr)
+        *error = std::move(message);
+}
+
+std::optional<std::string> read_file(const fs::path& path, std::string* error)
+{
+    std::ifstream in{path, std::ios::binary};
+    if (!in)
+    {
+        set_error(error, path.string() + ": cannot read the file");
+        return std::nullopt;
+    }
+    std::ostringstream text;
+    text << in.rdbuf();
+    return std::move(text).str();
+}
+
+/// Writes the file unless it already has this content (keeping its timestamp for the build).
+bool write_if_changed(const fs::path& path, const std::string& content, std::string* error)
+{
+    std::error_code ec;
+    if (fs::file_size(path, ec) == content.size())
+    {
+        if (const auto old = read_file(path, nullptr); old && *old == content)
+            return true;
+    }
+
+    std::ofstream out{path, std::ios::binary | std::ios::trunc};
+    out << content;
+    if (!out.flush())
+    {
+        set_error(error, path.string() + ": cannot write the file");
+        return false;
+    }
+    return true;
+}
+
+/// Parses the code in hex, ignoring the whitespace and the 0x prefix.
+std::optional<bytes> parse_code(std::string_view text)
+{
+    std::string hex;
+    for (const auto c : text)
+    {
+        if (!std::isspace(static_cast<unsigned char>(c)))
+            hex += c;
+    }
+    if (hex.starts_with("0x"))
+        hex.erase(0, 2);
+    return evmc::from_hex(hex);
+}
+
+/// Returns the string values of the "code" keys of the JSON text.
+///
+/// This is a plain scan rather than a JSON parser: it is enough for the files listing
+/// accounts (state tests, alloc and genesis files) as the code is always a string.
+std::vector<std::string_view> find_code_values(std::string_view json)
+{
+    constexpr std::string_view key = "\"code\"";
+    constexpr auto whitespace = " \t\r\n";
+    std::vector<std::string_view> values;
+    for (auto pos = json.find(key); pos != std::string_view::npos; pos = json.find(key, pos))
+    {
+        pos = json.find_first_not_of(whitespace, pos + key.size());
+        if (pos == std::string_view::npos || json[pos] != ':')
+            continue;  // Not a key.
+        pos = json.find_first_not_of(whitespace, pos + 1);
+        if (pos == std::string_view::npos || json[pos] != '"')
+            continue;
+        const auto end = json.find('"', pos + 1);
+        if (end == std::string_view::npos)
+            break;
+        values.push_back(json.substr(pos + 1, end - pos - 1));
+        pos = end + 1;
+    }
+    return values;
+}
+
+evmc::bytes32 code_hash(bytes_view code) noexcept
+{
+    const auto hash = ethash::keccak256(code.data(), code.size());
+    evmc::bytes32 h;
+    std::memcpy(h.bytes, hash.bytes, sizeof(h.bytes));
+    return h;
+}
+
+std::string quote(const fs::path& path)
+{
+    return '"' + path.string() + '"';
+}
+
+/// Returns the translation unit of the table of the compiled contracts (see registry.hpp).
+std::string registry_unit(
+    evmc_revision rev, const std::vector<bytes>& codes, const std::vector<std::string>& entries)
+{
+    std::string unit = "#include \"registry.hpp\"\nusing namespace evmone;\n\n";
+    for (const auto& entry : entries)
+        unit += "extern \"C\" evmc_result " + entry + "(ExecutionState& state);\n";
+
+    unit += "\nextern \"C\" EVMC_EXPORT const CompiledContract evmone_aot_contracts[] = {\n";
+    for (size_t i = 0; i < codes.size(); ++i)
+    {
+        const auto hash = code_hash(codes[i]);
+        unit += "    {{";
+        for (size_t j = 0; j < sizeof(hash.bytes); ++j)
+            unit += (j != 0 ? "," : "") + std::to_string(hash.bytes[j]);
+        unit += "}, evmc_revision(" + std::to_string(rev) + "), " + entries[i] + "},\n";
+    }
+    unit += "};\n\nextern \"C\" EVMC_EXPORT const size_t evmone_aot_num_contracts = " +
+            std::to_string(codes.size()) + ";\n";
+    return unit;
+}
+
+/// Returns the CMakeLists.txt of the library built from the given sources.
+std::string cmake_project(const std::vector<std::string>& sources, const CompileOptions& options)
+{
+    const fs::path runtime{EVMONE_COMPILER_RT};
+    const std::string target = batch_library_name;
+
+    std::string cmake = "# Generated by the evmone compiler: the contracts compiled with\n";
+    cmake += "#     compiler --batch <input> --output-dir <this directory>\n\n";
+    cmake += "cmake_minimum_required(VERSION 3.16)\n";
+    cmake += "set(CMAKE_CXX_COMPILER " + quote(EVMONE_COMPILER_CXX) + ")\n";
+    cmake += "project(" + target + " LANGUAGES CXX)\n\n";
+
+    cmake += "add_library(" + target + " SHARED\n";
+    for (const auto& source : sources)
+        cmake += "    " + source + "\n";
+    cmake += ")\n";
+    cmake += "target_compile_features(" + target + " PRIVATE cxx_std_23)\n";
+    cmake += "target_compile_options(" + target + " PRIVATE -fno-exceptions -w -O" +
+             std::to_string(options.opt_level) + ")\n";
+    cmake += "target_compile_definitions(" + target + " PRIVATE";
+    for (const auto& def : options.definitions())
+        cmake += " " + def.substr(2);  // Without "-D".
+    cmake += ")\n";
+    cmake += "target_include_directories(" + target + " PRIVATE";
+    for (const auto& dir : compiler_include_dirs())
+        cmake += " " + quote(dir);
+    cmake += ")\n";
+    cmake += "target_link_libraries(" + target + " PRIVATE " + quote(runtime) + ")\n";
+    cmake += "set_target_properties(" + target + " PROPERTIES CXX_EXTENSIONS OFF BUILD_RPATH " +
+             quote(runtime.parent_path()) + ")\n";
+    return cmake;
+}
+}  // namespace
+
+bool load_batch(const fs::path& input, std::vector<bytes>& codes, std::string* error)
+{
+    std::unordered_set<evmc::bytes32> hashes;
+    for (const auto& code : codes)
+        hashes.insert(code_hash(code));
+
+    const auto add = [&](std::string_view hex, const std::string& source) {
+        auto code = parse_code(hex);
+        if (!code)
+        {
+            set_error(error, source + ": invalid hex code");
+            return false;
+        }
+        if (!code->empty() && hashes.insert(code_hash(*code)).second)
+            codes.push_back(std::move(*code));
+        return true;
+    };
+
+    std::error_code ec;
+    if (fs::is_directory(input, ec))
+    {
+        std::vector<fs::path> files;
+        for (const auto& entry : fs::directory_iterator{input, ec})
+        {
+            if (entry.is_regular_file())
+                files.push_back(entry.path());
+        }
+        if (ec)
+        {
+            set_error(error, input.string() + ": " + ec.message());
+            return false;
+        }
+        std::sort(files.begin(), files.end());
+
+        for (const auto& file : files)
+        {
+            const auto text = read_file(file, error);
+            if (!text || !add(*text, file.string()))
+                return false;
+        }
+        return true;
+    }
+
+    const auto json = read_file(input, error);
+    if (!json)
+        return false;
+    for (const auto value : find_code_values(*json))
+    {
+        if (!add(value, input.string()))
+            return false;
+    }
+    return true;
+}
+
+bool write_batch_project(const fs::path& dir, evmc_revision rev, const std::vector<bytes>& codes,
+    const CompileOptions& options, std::string* error)
+{
+    if (codes.empty())
+    {
+        set_error(error, "no contracts to compile");
+        return false;
+    }
+
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+    if (ec)
+    {
+        set_error(error, dir.string() + ": " + ec.message());
+        return false;
+    }
+
+    std::vector<std::string> sources{"registry.cpp"};
+    std::vector<std::string> entries;
+    for (const auto& code : codes)
+    {
+        const auto name = contract_name(code);
+        entries.push_back("evmone_aot_" + name);
+        sources.push_back(name + ".cpp");
+        if (!write_if_changed(dir / sources.back(),
+                compile_translation_unit(rev, code, entries.back(), options), error))
+            return false;
+    }
+
+    return write_if_changed(dir / "registry.cpp", registry_unit(rev, codes, entries), error) &&
+           write_if_changed(dir / "CMakeLists.txt", cmake_project(sources, options), error);
+}
+
+fs::path build_batch_project(const fs::path& dir, unsigned jobs, std::string* error)
+{
+    if (jobs == 0)
+        jobs = std::max(std::thread::hardware_concurrency(), 1u);
+
+    const auto build_dir = dir / "build";
+    const auto configure = "cmake -S " + quote(dir) + " -B " + quote(build_dir) + " > /dev/null";
+    if (const auto status = std::system(configure.c_str()); status != 0)
+    {
+        set_error(error, "cmake failed to configure the project with status " +
+                             std::to_string(status));
+        return {};
+    }
+
+    const auto build = "cmake --build " + quote(build_dir) + " -j " + std::to_string(jobs);
+    if (const auto status = std::system(build.c_str()); status != 0)
+    {
+        set_error(error, "cmake failed to build the project with status " + std::to_string(status));
+        return {};
+    }
+
+    auto library = build_dir / ("lib" + std::string{batch_library_name} + ".so");
+    std::error_code ec;
+    if (!fs::exists(library, ec))
+    {
+        set_error(error, library.string() + ": not built");
+        return {};
+    }
+    return library;
+}
+}  // namespace evmone
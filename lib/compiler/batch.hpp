@@ -0,0 +1,43 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "codegen.hpp"
+#include <filesystem>
+
+namespace evmone
+{
+/// The name of the shared library target of the projects generated by write_batch_project().
+constexpr auto batch_library_name = "evmone-aot-contracts";
+
+/// Reads the codes of the contracts to compile in a batch from
+/// - a directory: every regular file holds the code of a contract in hex (0x prefix optional),
+/// - a JSON file (e.g. a state test or an alloc/genesis file): every "code" value is taken.
+///
+/// Empty codes are skipped and duplicates are removed. The codes are returned in the order
+/// of the file names (of the directory) or of their appearance (in the JSON file).
+/// Returns false on failure and sets the error message.
+bool load_batch(const std::filesystem::path& input, std::vector<bytes>& codes,
+    std::string* error = nullptr);
+
+/// Generates a CMake project building the contracts into a single shared library
+/// (lib<batch_library_name>.so) for the evmone-aot VM, see ContractRegistry::load():
+/// - <contract_name(code)>.cpp: the translation unit of each contract,
+/// - registry.cpp: the table evmone_aot_contracts mapping the code hashes to the entry points,
+/// - CMakeLists.txt: the library target, built with the C++ compiler and the compile options
+///   of the cache (see CodeCache::build()) and linked against compiler-rt.
+///
+/// The translation units are only rewritten if changed so that rebuilding the project after
+/// adding contracts only compiles the new ones.
+/// Returns false on failure and sets the error message.
+bool write_batch_project(const std::filesystem::path& dir, evmc_revision rev,
+    const std::vector<bytes>& codes, const CompileOptions& options, std::string* error = nullptr);
+
+/// Configures and builds the project generated by write_batch_project() in <dir>/build,
+/// compiling the contracts in parallel (jobs = 0: the number of CPUs).
+/// On success returns the path of the shared library, otherwise an empty path and sets
+/// the error message.
+std::filesystem::path build_batch_project(
+    const std::filesystem::path& dir, unsigned jobs = 0, std::string* error = nullptr);
+}  // namespace evmone
@@ -0,0 +1,159 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+/// The microbenchmark of the DIV/MOD/ADDMOD/MULMOD kernels of the compiler runtime
+/// (aot_intx.hpp), compared with intx and with the generic _BitInt lowering.
+/// Every kernel is run on the same random operands of various bit widths
+/// and the results are checked to be equal.
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include <intx/intx.hpp>
+#include "../Cycles.hpp"
+#include "aot_intx.hpp"
+
+using evmone::uint256;
+using evmone::uint257;
+using evmone::uint512;
+
+namespace
+{
+constexpr size_t num_inputs = 1024;
+constexpr size_t num_rounds = 1000;
+
+/// The bit widths of the operands x, y and of the divisor/modulus m.
+struct Shape
+{
+    const char* name;
+    unsigned x_bits;
+    unsigned y_bits;
+    unsigned m_bits;
+};
+
+constexpr Shape shapes[] = {
+    {"64/64", 64, 64, 64},
+    {"128/128", 128, 128, 128},
+    {"256/64", 256, 256, 64},
+    {"256/128", 256, 256, 128},
+    {"256/192", 256, 256, 192},
+    {"256/256", 256, 256, 256},
+};
+
+struct Inputs
+{
+    std::vector<uint256> x, y, m;
+    std::vector<intx::uint256> ix, iy, im;
+};
+
+/// Returns the random value of exactly the given number of bits.
+uint256 random_value(std::mt19937_64& gen, unsigned bits)
+{
+    uint256 v = 0;
+    for (unsigned i = 0; i < 4; ++i)
+        v = v << 64 | gen();
+    v >>= 256 - bits;
+    return v | uint256{1} << (bits - 1);
+}
+
+intx::uint256 to_intx(const uint256& v)
+{
+    const auto w = evmone::intx::to_words(v);
+    return {w[0], w[1], w[2], w[3]};
+}
+
+uint256 from_intx(const intx::uint256& v)
+{
+    return evmone::intx::from_words({v[0], v[1], v[2], v[3]});
+}
+
+Inputs make_inputs(const Shape& shape)
+{
+    std::mt19937_64 gen{shape.x_bits * 1000 + shape.m_bits};
+    Inputs in;
+    for (size_t i = 0; i < num_inputs; ++i)
+    {
+        in.x.push_back(random_value(gen, shape.x_bits));
+        in.y.push_back(random_value(gen, shape.y_bits));
+        in.m.push_back(random_value(gen, shape.m_bits));
+        in.ix.push_back(to_intx(in.x.back()));
+        in.iy.push_back(to_intx(in.y.back()));
+        in.im.push_back(to_intx(in.m.back()));
+    }
+    return in;
+}
+
+/// Returns the average number of cycles of op(i) over all the inputs.
+template <typename Op>
+uint64_t cycles_per_op(const Op& op)
+{
+    uint64_t sink = 0;
+    const auto start = PerfUtils::Cycles::rdtsc();
+    for (size_t r = 0; r < num_rounds; ++r)
+    {
+        for (size_t i = 0; i < num_inputs; ++i)
+            sink += uint64_t(op(i));
+    }
+    const auto elapsed = PerfUtils::Cycles::rdtsc() - start;
+    [[maybe_unused]] volatile auto keep = sink;
+    return elapsed / (num_rounds * num_inputs);
+}
+
+/// Runs the three implementations of an operation and prints their cycles per operation.
+/// The results must be equal: exits otherwise.
+template <typename Aot, typename Generic, typename Intx>
+void run(const char* shape, const char* name, const Aot& aot, const Generic& generic,
+    const Intx& intx_op)
+{
+    for (size_t i = 0; i < num_inputs; ++i)
+    {
+        const auto expected = generic(i);
+        if (aot(i) != expected || from_intx(intx_op(i)) != expected)
+        {
+            std::printf("%s %s: the results differ for the input %zu\n", name, shape, i);
+            std::exit(1);
+        }
+    }
+
+    std::printf("%-8s %-8s %10lu %10lu %10lu\n", shape, name, cycles_per_op(aot),
+        cycles_per_op(generic), cycles_per_op([&](size_t i) { return intx_op(i)[0]; }));
+}
+}  // namespace
+
+int main()
+{
+    PerfUtils::Cycles::init();
+    std::printf("%-8s %-8s %10s %10s %10s\n", "shape", "op", "aot", "_BitInt", "intx");
+    std::printf("%-8s %-8s %10s %10s %10s\n", "", "", "[cycles]", "[cycles]", "[cycles]");
+
+    for (const auto& shape : shapes)
+    {
+        const auto in = make_inputs(shape);
+        const auto& x = in.x;
+        const auto& y = in.y;
+        const auto& m = in.m;
+        const auto& ix = in.ix;
+        const auto& iy = in.iy;
+        const auto& im = in.im;
+
+        run(
+            shape.name, "div", [&](size_t i) { return evmone::intx::udivrem(x[i], m[i]).quot; },
+            [&](size_t i) { return x[i] / m[i]; },
+            [&](size_t i) { return intx::udivrem(ix[i], im[i]).quot; });
+        run(
+            shape.name, "mod", [&](size_t i) { return evmone::intx::udivrem(x[i], m[i]).rem; },
+            [&](size_t i) { return x[i] % m[i]; },
+            [&](size_t i) { return intx::udivrem(ix[i], im[i]).rem; });
+        run(
+            shape.name, "addmod", [&](size_t i) { return evmone::intx::addmod(x[i], y[i], m[i]); },
+            [&](size_t i) { return uint256((uint257(x[i]) + y[i]) % m[i]); },
+            [&](size_t i) { return intx::addmod(ix[i], iy[i], im[i]); });
+        run(
+            shape.name, "mulmod", [&](size_t i) { return evmone::intx::mulmod(x[i], y[i], m[i]); },
+            [&](size_t i) { return uint256((uint512(x[i]) * y[i]) % m[i]); },
+            [&](size_t i) { return intx::mulmod(ix[i], iy[i], im[i]); });
+    }
+}
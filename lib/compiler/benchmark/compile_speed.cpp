@@ -0,0 +1,306 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+/// The compile-speed benchmark of the compiler. For the contracts of the corpus directory
+/// (fib, snailtracer, ...) and synthetic contracts of growing size it measures
+/// - the time of compile_cxx() and the size of the generated C++ translation unit,
+/// - the time of the C++ compiler building the object, split by clang's -ftime-trace
+///   into the frontend, the optimizer and the code generation,
+/// - the size of the native code (the .text sections of the object),
+/// and prints the results as JSON.
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+#include <evmc/hex.hpp>
+#include "../CLI11.hpp"
+#include "../codegen.hpp"
+#include "../instructions_opcodes.hpp"
+#include "Cycles.hpp"
+
+using namespace evmone;
+namespace fs = std::filesystem;
+
+namespace
+{
+struct Contract
+{
+    std::string name;
+    bytes code;
+};
+
+struct Measurement
+{
+    uint64_t compile_cxx_us = 0;  ///< The best time of compile_cxx().
+    size_t cxx_size = 0;          ///< The size of the generated C++ translation unit.
+    uint64_t cxx_us = 0;          ///< The wall time of the C++ compiler process.
+
+    /// The phases of the C++ compiler, if it reported them (clang -ftime-trace).
+    std::optional<uint64_t> frontend_us;
+    std::optional<uint64_t> optimizer_us;
+    std::optional<uint64_t> codegen_us;
+
+    std::optional<uint64_t> text_size;  ///< The size of the native code.
+};
+
+std::optional<std::string> read_file(const fs::path& path)
+{
+    std::ifstream in{path, std::ios::binary};
+    if (!in)
+        return std::nullopt;
+    std::ostringstream text;
+    text << in.rdbuf();
+    return std::move(text).str();
+}
+
+/// Returns the contracts of the *.hex files of the directory, named after the files.
+std::vector<Contract> load_corpus(const fs::path& dir)
+{
+    std::vector<fs::path> files;
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator{dir, ec})
+    {
+        if (entry.is_regular_file() && entry.path().extension() == ".hex")
+            files.push_back(entry.path());
+    }
+    std::sort(files.begin(), files.end());
+
+    std::vector<Contract> contracts;
+    for (const auto& file : files)
+    {
+        auto hex = read_file(file).value_or("");
+        std::erase_if(hex, [](char c) { return std::isspace(static_cast<unsigned char>(c)); });
+        if (auto code = evmc::from_hex(hex); code && !code->empty())
+            contracts.push_back({file.stem().string(), std::move(*code)});
+        else
+            std::fprintf(stderr, "%s: invalid hex code, skipped\n", file.c_str());
+    }
+    return contracts;
+}
+
+/// Returns a synthetic contract of about the given size: a chain of small loops of
+/// arithmetic and memory instructions, 19 bytes and a basic block each.
+bytes synthetic_contract(size_t size)
+{
+    bytes code;
+    while (code.size() + 20 <= size)
+    {
+        const auto loop = code.size();
+        code += bytes{
+            OP_JUMPDEST,
+            OP_PUSH1, 0x01, OP_PUSH1, 0x02, OP_ADD,
+            OP_DUP1, OP_PUSH1, 0x03, OP_MUL,
+            OP_PUSH1, 0x00, OP_MSTORE, OP_POP,
+            OP_CALLDATASIZE, OP_PUSH2, uint8_t(loop >> 8), uint8_t(loop), OP_JUMPI,
+        };
+    }
+    code.push_back(OP_STOP);
+    return code;
+}
+
+/// Returns the total duration in microseconds of the events of the given name recorded by
+/// clang -ftime-trace (its "Total <name>" summary event), if any.
+std::optional<uint64_t> trace_total(std::string_view trace, std::string_view name)
+{
+    const auto key = "\"name\":\"Total " + std::string{name} + '"';
+    const auto pos = trace.find(key);
+    if (pos == std::string_view::npos)
+        return std::nullopt;
+
+    // The event is a flat object: {"pid":..,"tid":..,"ph":"X","ts":0,"dur":..,"name":.., ...}
+    const auto begin = trace.rfind('{', pos);
+    if (begin == std::string_view::npos)
+        return std::nullopt;
+    const auto dur = trace.substr(begin, trace.find('}', pos) - begin).find("\"dur\":");
+    if (dur == std::string_view::npos)
+        return std::nullopt;
+    return std::strtoull(trace.data() + begin + dur + 6, nullptr, 10);
+}
+
+/// Returns the total size of the .text sections of the ELF64 object file.
+std::optional<uint64_t> text_size(const fs::path& object)
+{
+    const auto elf = read_file(object);
+    if (!elf || elf->size() < 64 || elf->compare(0, 4, "\x7f" "ELF") != 0 || (*elf)[4] != 2)
+        return std::nullopt;
+
+    // Little-endian, as the host.
+    const auto read = [&elf](size_t pos, size_t size) {
+        uint64_t value = 0;
+        if (pos + size <= elf->size())
+            std::memcpy(&value, elf->data() + pos, size);
+        return value;
+    };
+    const auto shoff = read(0x28, 8);
+    const auto shentsize = read(0x3a, 2);
+    const auto shnum = read(0x3c, 2);
+    const auto shstrndx = read(0x3e, 2);
+    if (shoff + shnum * shentsize > elf->size() || shstrndx >= shnum)
+        return std::nullopt;
+
+    const auto strtab = read(shoff + shstrndx * shentsize + 0x18, 8);
+    uint64_t size = 0;
+    for (uint64_t i = 0; i < shnum; ++i)
+    {
+        const auto header = shoff + i * shentsize;
+        const auto name = strtab + read(header, 4);
+        if (name < elf->size() && std::string_view{elf->c_str() + name}.starts_with(".text"))
+            size += read(header + 0x20, 8);
+    }
+    return size;
+}
+
+/// Builds the object of the translation unit in the working directory with the C++ compiler
+/// evmone was built with (as CodeCache::build(), but without linking) and measures it.
+bool build_object(
+    const std::string& unit, const fs::path& dir, const CompileOptions& options, Measurement& m)
+{
+    const auto source = dir / "contract.cpp";
+    const auto object = dir / "contract.o";
+    const auto trace = dir / "contract.json";  // Named after the object by clang.
+    std::ofstream{source} << unit;
+    std::error_code ec;
+    fs::remove(trace, ec);
+
+    std::string cmd = EVMONE_COMPILER_CXX " -std=c++23 -c -fPIC -fno-exceptions -w -ftime-trace";
+    cmd += " -O" + std::to_string(options.opt_level);
+    for (const auto& def : options.definitions())
+        cmd += " " + def;
+    cmd += " -I" EVMONE_COMPILER_INCLUDE_DIRS;
+    cmd += " -o " + object.string() + " " + source.string();
+
+    using namespace PerfUtils;
+    const auto start = Cycles::rdtsc();
+    const auto status = std::system(cmd.c_str());
+    m.cxx_us = Cycles::toMicroseconds(Cycles::rdtsc() - start);
+    if (status != 0)
+        return false;
+
+    if (const auto trace_json = read_file(trace))
+    {
+        m.frontend_us = trace_total(*trace_json, "Frontend");
+        m.optimizer_us = trace_total(*trace_json, "Optimizer");
+        m.codegen_us = trace_total(*trace_json, "CodeGenPasses");
+    }
+    m.text_size = text_size(object);
+    return true;
+}
+
+std::string to_json(const std::optional<uint64_t>& value)
+{
+    return value ? std::to_string(*value) : "null";
+}
+
+std::string to_json(const Contract& contract, const Measurement& m)
+{
+    return "{\"name\": \"" + contract.name + "\", \"code_size\": " +
+           std::to_string(contract.code.size()) +
+           ", \"compile_cxx_us\": " + std::to_string(m.compile_cxx_us) +
+           ", \"cxx_size\": " + std::to_string(m.cxx_size) +
+           ", \"cxx_us\": " + std::to_string(m.cxx_us) +
+           ", \"frontend_us\": " + to_json(m.frontend_us) +
+           ", \"optimizer_us\": " + to_json(m.optimizer_us) +
+           ", \"codegen_us\": " + to_json(m.codegen_us) +
+           ", \"text_size\": " + to_json(m.text_size) + "}";
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    std::string corpus_dir = EVMONE_COMPILE_SPEED_CORPUS;
+    std::vector<size_t> sizes{1024, 2048, 4096, 8192, 16384, 24576};
+    unsigned repeat = 10;
+    bool no_cxx = false;
+    std::string output;
+    uint8_t evmc_rev = evmc_revision::EVMC_SHANGHAI;
+    CompileOptions options;
+    CLI::App app{"compile-speed"};
+    app.add_option("--corpus", corpus_dir,
+            "Directory of the contracts (*.hex) to compile (default: benchmark/corpus)");
+    app.add_option("--synthetic-sizes", sizes,
+            "Code sizes of the synthetic contracts (default: 1024 2048 4096 8192 16384 24576)");
+    app.add_option("--repeat", repeat,
+            "Number of runs of compile_cxx() per contract, the best is reported (default: 10)")
+            ->check(CLI::Range(1, 1000000));
+    app.add_flag("--no-cxx", no_cxx,
+            "Only measure compile_cxx(), do not run the C++ compiler");
+    app.add_option("--evm-revision", evmc_rev,
+            "Revision number of the EVM specification (default: 12 [SHANGHAI])")
+            ->check(CLI::Range(0, int(evmc_revision::EVMC_MAX_REVISION)));
+    app.add_option("--opt-level", options.opt_level,
+            "Optimization level of the C++ compiler (default: 2)")
+            ->check(CLI::Range(0, 3));
+    app.add_option("--max-region-size", options.max_region_size,
+            "Split contracts into functions of about this number of instructions, 0 to disable "
+            "(default: 2000)");
+    app.add_option("--gas-check-loc", options.gas_check_loc,
+            "Where to check the gas (GAS_CHECK_LOC), 3 to let the compiler place the checks "
+            "(default: 1)")
+            ->check(CLI::Range(0, 3));
+    app.add_option("-o,--output", output,
+            "Write the JSON results to this file (default: the standard output)");
+    CLI11_PARSE(app, argc, argv)
+
+    auto contracts = load_corpus(corpus_dir);
+    for (const auto size : sizes)
+        contracts.push_back({"synthetic_" + std::to_string(size), synthetic_contract(size)});
+
+    const auto work_dir =
+        fs::temp_directory_path() / ("evmone-compile-speed." + std::to_string(::getpid()));
+    fs::create_directories(work_dir);
+
+    using namespace PerfUtils;
+    const auto rev = evmc_revision(evmc_rev);
+    std::string results;
+    for (const auto& contract : contracts)
+    {
+        std::fprintf(stderr, "%s (%zu bytes)\n", contract.name.c_str(), contract.code.size());
+
+        Measurement m;
+        m.compile_cxx_us = UINT64_MAX;
+        for (unsigned i = 0; i < repeat; ++i)
+        {
+            const auto start = Cycles::rdtsc();
+            [[maybe_unused]] const auto compiled = compile_cxx(rev, contract.code, options);
+            m.compile_cxx_us =
+                std::min(m.compile_cxx_us, Cycles::toMicroseconds(Cycles::rdtsc() - start));
+        }
+
+        // The size of what the C++ compiler gets: the code of the contract and its wrapper.
+        const auto unit = compile_translation_unit(rev, contract.code, "entry", options);
+        m.cxx_size = unit.size();
+        if (!no_cxx && !build_object(unit, work_dir, options, m))
+            std::fprintf(stderr, "%s: the C++ compiler failed\n", contract.name.c_str());
+
+        results += (results.empty() ? "\n    " : ",\n    ") + to_json(contract, m);
+    }
+    std::error_code ec;
+    fs::remove_all(work_dir, ec);
+
+    const auto json = "{\n  \"compiler\": \"" EVMONE_COMPILER_CXX "\",\n  \"evm_revision\": " +
+                      std::to_string(evmc_rev) +
+                      ",\n  \"opt_level\": " + std::to_string(options.opt_level) +
+                      ",\n  \"max_region_size\": " + std::to_string(options.max_region_size) +
+                      ",\n  \"gas_check_loc\": " + std::to_string(options.gas_check_loc) +
+                      ",\n  \"contracts\": [" + results + "\n  ]\n}\n";
+    if (output.empty())
+    {
+        std::fputs(json.c_str(), stdout);
+        return 0;
+    }
+    std::ofstream out{output};
+    out << json;
+    return out ? 0 : 1;
+}
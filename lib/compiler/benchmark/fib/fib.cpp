@@ -14,10 +14,12 @@ using namespace evmone;
   EVM revision: Shanghai
   contract hex code: 5f35600060015b8215601b578181019150909160019003916006565b91505000
 */
+static constexpr std::array<uint16_t, 28> contract_0x3b2446dffe1de3628f8e1959888d96b25bcf72b5012af4dbb83ecbf17fd9570d_jumpdest_index {0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2};
 evmc_result contract_0x3b2446dffe1de3628f8e1959888d96b25bcf72b5012af4dbb83ecbf17fd9570d(ExecutionState& state)
 {
-PROLOGUE
-constexpr JumpdestMap jumpdest_map {2, {6,27}, {&&L_OFFSET_6,&&L_OFFSET_27}};
+PROLOGUE(EVMC_SHANGHAI)
+static constexpr std::array<native_jumpdest, 3> jumpdest_map_labels {nullptr,&&L_OFFSET_6,&&L_OFFSET_27};
+constexpr JumpdestMap<uint16_t> jumpdest_map {contract_0x3b2446dffe1de3628f8e1959888d96b25bcf72b5012af4dbb83ecbf17fd9570d_jumpdest_index.size(), contract_0x3b2446dffe1de3628f8e1959888d96b25bcf72b5012af4dbb83ecbf17fd9570d_jumpdest_index.data(), jumpdest_map_labels.data()};
 
 BLOCK_START(0, 11, 0, 3)
 INVOKE(PUSH0)
@@ -59,10 +61,12 @@ EPILOGUE
   EVM revision: Shanghai
   contract hex code: 5f35600060015b8215601f575b818101915090916001900391821515600c575b91505000
 */
+static constexpr std::array<uint16_t, 32> contract_0xb5b6fa5a4a33eb343fc84af28dca9b1a79bb65f6cf0aee90e9d3f9f7f527f6b1_jumpdest_index {0,0,0,0,0,0,1,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3};
 evmc_result contract_0xb5b6fa5a4a33eb343fc84af28dca9b1a79bb65f6cf0aee90e9d3f9f7f527f6b1(ExecutionState& state)
 {
-PROLOGUE
-constexpr JumpdestMap jumpdest_map {3, {6,12,31}, {&&L_OFFSET_6,&&L_OFFSET_12,&&L_OFFSET_31}};
+PROLOGUE(EVMC_SHANGHAI)
+static constexpr std::array<native_jumpdest, 4> jumpdest_map_labels {nullptr,&&L_OFFSET_6,&&L_OFFSET_12,&&L_OFFSET_31};
+constexpr JumpdestMap<uint16_t> jumpdest_map {contract_0xb5b6fa5a4a33eb343fc84af28dca9b1a79bb65f6cf0aee90e9d3f9f7f527f6b1_jumpdest_index.size(), contract_0xb5b6fa5a4a33eb343fc84af28dca9b1a79bb65f6cf0aee90e9d3f9f7f527f6b1_jumpdest_index.data(), jumpdest_map_labels.data()};
 
 BLOCK_START(0, 11, 0, 3)
 INVOKE(PUSH0)
@@ -109,10 +113,12 @@ EPILOGUE
   contract hex code: 6080604052348015600f57600080fd5b506004361060285760003560e01c806361047ff414602d575b600080fd5b603c6038366004607d565b604e565b60405190815260200160405180910390f35b60006002821015605c575090565b6000600160025b84811160755790918201906001016063565b509392505050565
 b600060208284031215608e57600080fd5b503591905056
 */
+static constexpr std::array<uint16_t, 143> contract_0x4caeaf714b12f4f7b28a334532c89f43b1fa92009d4171a2b49563858d85c499_jumpdest_index {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,4,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11};
 evmc_result contract_0x4caeaf714b12f4f7b28a334532c89f43b1fa92009d4171a2b49563858d85c499(ExecutionState& state)
 {
-PROLOGUE
-constexpr JumpdestMap jumpdest_map {11, {15,40,45,56,60,78,92,99,117,125,142}, {&&L_OFFSET_15,&&L_OFFSET_40,&&L_OFFSET_45,&&L_OFFSET_56,&&L_OFFSET_60,&&L_OFFSET_78,&&L_OFFSET_92,&&L_OFFSET_99,&&L_OFFSET_117,&&L_OFFSET_125,&&L_OFFSET_142}};
+PROLOGUE(EVMC_SHANGHAI)
+static constexpr std::array<native_jumpdest, 12> jumpdest_map_labels {nullptr,&&L_OFFSET_15,&&L_OFFSET_40,&&L_OFFSET_45,&&L_OFFSET_56,&&L_OFFSET_60,&&L_OFFSET_78,&&L_OFFSET_92,&&L_OFFSET_99,&&L_OFFSET_117,&&L_OFFSET_125,&&L_OFFSET_142};
+constexpr JumpdestMap<uint16_t> jumpdest_map {contract_0x4caeaf714b12f4f7b28a334532c89f43b1fa92009d4171a2b49563858d85c499_jumpdest_index.size(), contract_0x4caeaf714b12f4f7b28a334532c89f43b1fa92009d4171a2b49563858d85c499_jumpdest_index.data(), jumpdest_map_labels.data()};
 
 BLOCK_START(0, 30, 0, 3)
 INVOKE(PUSH1, 0x80_u256)
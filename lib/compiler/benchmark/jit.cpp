@@ -0,0 +1,74 @@
+#include <cstdio>
+#include <string>
+
+#include <evmc/evmc.hpp>
+#include <evmc/hex.hpp>
+#include <evmc/mocked_host.hpp>
+#include "../CLI11.hpp"
+#include "../jit.hpp"
+#include "Cycles.hpp"
+
+using namespace evmone;
+
+int main(int argc, char** argv)
+{
+    std::string hex_code;
+    std::string hex_calldata;
+    int64_t gas = 1000000000000ll;
+    uint8_t evmc_rev = evmc_revision::EVMC_SHANGHAI;
+    CLI::App app{"jit"};
+    app.add_option("--contract-code", hex_code,
+           "Runtime contract code in hex format")->required();
+    app.add_option("--calldata", hex_calldata,
+           "Calldata in hex format")->required();
+    app.add_option("--gas", gas,
+           "Gas available for execution (default: 10^12)");
+    app.add_option("--evm-revision", evmc_rev,
+           "Revision number of the EVM specification (default: 12 [SHANGHAI])")
+           ->check(CLI::Range(0, int(evmc_revision::EVMC_MAX_REVISION)));
+    CLI11_PARSE(app, argc, argv)
+
+    auto bytecode = evmc::from_hex(hex_code);
+    auto calldata = evmc::from_hex(hex_calldata);
+    if (!bytecode) {
+        printf("Failed to parse the contract code!\n");
+        return 0;
+    } else if (!calldata) {
+        printf("Failed to parse the calldata!\n");
+        return 0;
+    }
+
+    using namespace PerfUtils;
+    std::string error;
+    auto cyc = Cycles::rdtsc();
+    const auto jit = Jit::create({}, &error);
+    if (!jit) {
+        printf("Failed to create the JIT: %s\n", error.c_str());
+        return 1;
+    }
+    const auto contract = jit->compile(evmc_revision(evmc_rev), bytecode.value(), &error);
+    if (!contract) {
+        printf("Failed to compile the contract:\n%s\n", error.c_str());
+        return 1;
+    }
+    cyc = Cycles::rdtsc() - cyc;
+    printf("compiled in %lu ms\n", Cycles::toMilliseconds(cyc));
+
+    const evmc_message msg {
+        .gas = gas,
+        .input_data = calldata.value().c_str(),
+        .input_size = calldata.value().size()
+    };
+    evmc::MockedHost host;
+    ExecutionState state;
+    state.msg = &msg;
+    state.rev = evmc_revision(evmc_rev);
+    state.host = {host.get_interface(), host.to_context()};
+    state.original_code = bytecode.value();
+
+    cyc = Cycles::rdtsc();
+    auto result = contract(state);
+    cyc = Cycles::rdtsc() - cyc;
+    printf("ret_code = %d, gas_left = %ld, elapsed = %lu ms\n", result.status_code, result.gas_left,
+        Cycles::toMilliseconds(cyc));
+}
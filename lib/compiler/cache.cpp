@@ -0,0 +1,576 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "cache.hpp"
+#include <evmc/hex.hpp>
+#include <ethash/keccak.hpp>
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <unordered_set>
+
+extern char** environ;
+
+namespace evmone
+{
+namespace fs = std::filesystem;
+
+namespace
+{
+/// The name of the index file in the cache directory.
+constexpr auto index_file_name = "index";
+
+/// The number of index records allocated for a new cache.
+constexpr uint64_t initial_capacity = 64;
+
+void set_error(std::string* error, std::string message)
+{
+    if (error != nullptr)
+        *error = std::move(message);
+}
+
+/// Runs the program args[0] (looked up in PATH) with the arguments, without a shell.
+/// Returns its exit status, or -1 if it could not be run or was killed.
+int run_program(const std::vector<std::string>& args)
+{
+    std::vector<char*> argv;
+    for (const auto& arg : args)
+        argv.push_back(const_cast<char*>(arg.c_str()));
+    argv.push_back(nullptr);
+
+    pid_t pid = 0;
+    if (::posix_spawnp(&pid, argv[0], nullptr, nullptr, argv.data(), environ) != 0)
+        return -1;
+    int status = 0;
+    while (::waitpid(pid, &status, 0) < 0)
+    {
+        if (errno != EINTR)
+            return -1;
+    }
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+/// Builds the shared object of a translation unit with the C++ compiler evmone was built with.
+/// The object is linked against compiler-rt.
+bool build_shared_object(const std::string& unit, const fs::path& output,
+    const CompileOptions& options, std::string* error)
+{
+    auto source = output;
+    source.replace_extension(".cpp");
+    std::ofstream{source} << unit;
+
+    const fs::path runtime{EVMONE_COMPILER_RT};
+    std::vector<std::string> args{EVMONE_COMPILER_CXX, "-std=c++23", "-shared", "-fPIC",
+        "-fno-exceptions", "-w", "-O" + std::to_string(options.opt_level)};
+    for (const auto& def : options.definitions())
+        args.push_back(def);
+    for (const auto& dir : compiler_include_dirs())
+        args.push_back("-I" + dir);
+    args.insert(args.end(), {"-o", output.string(), source.string(), runtime.string(),
+                                "-Wl,-rpath," + runtime.parent_path().string()});
+    const auto status = run_program(args);
+    std::error_code ec;
+    fs::remove(source, ec);
+    if (status != 0)
+    {
+        set_error(error, status < 0 ? std::string{"the C++ compiler could not be run"} :
+                                      "the C++ compiler failed with status " +
+                                          std::to_string(status));
+        fs::remove(output, ec);
+        return false;
+    }
+    return true;
+}
+
+/// Holds the exclusive lock of the index file, serializing the processes sharing the cache.
+/// The threads of a process are serialized by CodeCache::m_mutex.
+class IndexLock
+{
+    int m_fd;
+
+public:
+    explicit IndexLock(int fd) noexcept : m_fd{fd}
+    {
+        while (::flock(m_fd, LOCK_EX) != 0 && errno == EINTR)
+        {
+        }
+    }
+
+    ~IndexLock() noexcept { ::flock(m_fd, LOCK_UN); }
+
+    IndexLock(const IndexLock&) = delete;
+    IndexLock& operator=(const IndexLock&) = delete;
+};
+}  // namespace
+
+/// The header of the index file, followed by `capacity` records.
+struct CodeCache::IndexHeader
+{
+    /// "EVMAOTC3" in little-endian. Bump it when the index layout changes.
+    static constexpr uint64_t current_magic = 0x3343544f414d5645;
+
+    uint64_t magic;
+    uint64_t count;       ///< The number of used records.
+    uint64_t capacity;    ///< The number of allocated records.
+    uint64_t clock;       ///< The logical time of the last lookup.
+    uint64_t generation;  ///< Incremented whenever records are added, removed or moved.
+};
+
+struct CodeCache::IndexRecord
+{
+    uint8_t code_hash[32];
+    uint32_t rev;
+    uint32_t options;
+    uint32_t abi;
+    uint32_t reserved;
+    uint64_t size;       ///< The size of the shared object in bytes.
+    uint64_t last_used;  ///< The logical time of the last lookup.
+
+    [[nodiscard]] CacheKey key() const noexcept
+    {
+        CacheKey k;
+        std::memcpy(k.code_hash.bytes, code_hash, sizeof(code_hash));
+        k.rev = static_cast<evmc_revision>(rev);
+        k.options = options;
+        k.abi = abi;
+        return k;
+    }
+};
+
+std::vector<std::string> compiler_include_dirs()
+{
+    // EVMONE_COMPILER_INCLUDE_DIRS is a list separated by " -I", made for a command line.
+    constexpr std::string_view separator = " -I";
+    const std::string_view dirs = EVMONE_COMPILER_INCLUDE_DIRS;
+    std::vector<std::string> result;
+    for (size_t pos = 0; pos <= dirs.size();)
+    {
+        const auto end = std::min(dirs.find(separator, pos), dirs.size());
+        if (end != pos)
+            result.emplace_back(dirs.substr(pos, end - pos));
+        pos = end + separator.size();
+    }
+    return result;
+}
+
+const uint32_t CacheKey::current_abi = EVMONE_COMPILER_ABI;
+
+CacheKey::CacheKey(evmc_revision rev_, bytes_view code, const CompileOptions& options_) noexcept
+  : rev{rev_}, options{options_.fingerprint()}
+{
+    const auto hash = ethash::keccak256(code.data(), code.size());
+    std::memcpy(code_hash.bytes, hash.bytes, sizeof(code_hash.bytes));
+}
+
+size_t CodeCache::KeyHash::operator()(const CacheKey& key) const noexcept
+{
+    uint64_t h = 0;
+    std::memcpy(&h, key.code_hash.bytes, sizeof(h));
+    return h ^ (uint64_t{key.rev} << 32 | key.options) ^ uint64_t{key.abi} << 16;
+}
+
+std::unique_ptr<CodeCache> CodeCache::open(
+    const fs::path& dir, uint64_t size_budget, std::string* error)
+{
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+    if (ec)
+    {
+        set_error(error, dir.string() + ": " + ec.message());
+        return nullptr;
+    }
+
+    std::unique_ptr<CodeCache> cache{new CodeCache};
+    cache->m_dir = dir;
+    cache->m_size_budget = size_budget;
+
+    const auto index_path = dir / index_file_name;
+    cache->m_index_fd = ::open(index_path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (cache->m_index_fd < 0)
+    {
+        set_error(error, index_path.string() + ": " + std::strerror(errno));
+        return nullptr;
+    }
+    const IndexLock index_lock{cache->m_index_fd};
+
+    // Reuse the existing index if it is consistent, start from scratch otherwise.
+    struct stat st = {};
+    IndexHeader header = {};
+    bool valid = ::fstat(cache->m_index_fd, &st) == 0 &&
+                 size_t(st.st_size) >= sizeof(header) &&
+                 ::pread(cache->m_index_fd, &header, sizeof(header), 0) == sizeof(header) &&
+                 header.magic == IndexHeader::current_magic && header.count <= header.capacity &&
+                 size_t(st.st_size) == sizeof(header) + header.capacity * sizeof(IndexRecord);
+
+    if (!cache->map_index(valid ? header.capacity : initial_capacity, error))
+        return nullptr;
+    if (!valid)
+        *cache->m_header = {IndexHeader::current_magic, 0, initial_capacity, 0, 0};
+
+    // Load the entries, dropping the ones whose shared objects have disappeared.
+    auto* const recs = cache->records();
+    std::unordered_set<std::string> object_names;
+    size_t count = 0;
+    for (size_t i = 0; i < cache->m_header->count; ++i)
+    {
+        const auto key = recs[i].key();
+        const auto path = cache->object_path(key);
+        if (!fs::is_regular_file(path, ec) || cache->m_entries.contains(key))
+            continue;
+        recs[count] = recs[i];
+        cache->m_entries[key] = {count, nullptr, nullptr};
+        cache->m_total_size += recs[count].size;
+        object_names.insert(path.filename().string());
+        ++count;
+    }
+    if (count != cache->m_header->count)
+    {
+        cache->m_header->count = count;
+        cache->bump_generation();
+    }
+    cache->m_generation = cache->m_header->generation;
+
+    // The header is also mapped on its own, for generation() reading it without the locks
+    // while map_index() may replace the mapping of the index.
+    auto* const header_view =
+        ::mmap(nullptr, sizeof(IndexHeader), PROT_READ, MAP_SHARED, cache->m_index_fd, 0);
+    if (header_view == MAP_FAILED)
+    {
+        set_error(error, index_path.string() + ": " + std::strerror(errno));
+        return nullptr;
+    }
+    cache->m_header_view = static_cast<IndexHeader*>(header_view);
+
+    // Remove shared objects not referenced by the index (e.g. after a crash in insert()).
+    // Other processes only add objects with the index locked so theirs are all in the index.
+    for (const auto& file : fs::directory_iterator{dir, ec})
+    {
+        const auto& path = file.path();
+        if (path.extension() == ".so" && !object_names.contains(path.filename().string()))
+            fs::remove(path, ec);
+    }
+
+    cache->evict();
+    return cache;
+}
+
+CodeCache::~CodeCache() noexcept
+{
+    for (const auto& [key, entry] : m_entries)
+    {
+        if (entry.handle != nullptr)
+            ::dlclose(entry.handle);
+    }
+    for (auto* handle : m_evicted_handles)
+        ::dlclose(handle);
+    if (m_header != nullptr)
+        ::munmap(m_header, m_mapped_size);
+    if (m_header_view != nullptr)
+        ::munmap(m_header_view, sizeof(IndexHeader));
+    if (m_index_fd >= 0)
+        ::close(m_index_fd);
+}
+
+CodeCache::IndexRecord* CodeCache::records() const noexcept
+{
+    return reinterpret_cast<IndexRecord*>(m_header + 1);
+}
+
+fs::path CodeCache::object_path(const CacheKey& key) const
+{
+    return m_dir / (evmc::hex({key.code_hash.bytes, sizeof(key.code_hash.bytes)}) + '-' +
+                       std::to_string(key.rev) + '-' + std::to_string(key.options) + '-' +
+                       std::to_string(key.abi) + ".so");
+}
+
+bool CodeCache::map_index(uint64_t capacity, std::string* error) noexcept
+{
+    // The current mapping is kept on failure.
+    const auto size = sizeof(IndexHeader) + capacity * sizeof(IndexRecord);
+    if (::ftruncate(m_index_fd, off_t(size)) != 0)
+    {
+        set_error(error, std::strerror(errno));
+        return false;
+    }
+    auto* const p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_index_fd, 0);
+    if (p == MAP_FAILED)
+    {
+        set_error(error, std::strerror(errno));
+        return false;
+    }
+    if (m_header != nullptr)
+        ::munmap(m_header, m_mapped_size);
+    m_header = static_cast<IndexHeader*>(p);
+    m_mapped_size = size;
+    m_header->capacity = capacity;
+    return true;
+}
+
+bool CodeCache::refresh(std::string* error) noexcept
+{
+    // The index has grown if another process has inserted entries into the full index.
+    struct stat st = {};
+    if (::fstat(m_index_fd, &st) != 0)
+    {
+        set_error(error, std::strerror(errno));
+        return false;
+    }
+    if (size_t(st.st_size) != m_mapped_size)
+    {
+        if (size_t(st.st_size) < sizeof(IndexHeader))
+        {
+            set_error(error, "the index file is truncated");
+            return false;
+        }
+        if (!map_index((size_t(st.st_size) - sizeof(IndexHeader)) / sizeof(IndexRecord), error))
+            return false;
+    }
+    if (m_header->generation == m_generation)
+        return true;
+
+    // Rebuild the entries from the index, keeping the objects already loaded.
+    const auto* const recs = records();
+    std::unordered_map<CacheKey, Entry, KeyHash> entries;
+    m_total_size = 0;
+    for (size_t i = 0; i < m_header->count; ++i)
+    {
+        const auto key = recs[i].key();
+        auto& entry = entries[key];
+        entry.record = i;
+        if (const auto it = m_entries.find(key); it != m_entries.end())
+        {
+            entry.handle = it->second.handle;
+            entry.fn = it->second.fn;
+            m_entries.erase(it);
+        }
+        m_total_size += recs[i].size;
+    }
+
+    // The rest has been evicted by other processes. The entry points may still be in use.
+    for (const auto& [key, entry] : m_entries)
+    {
+        if (entry.handle != nullptr)
+            m_evicted_handles.push_back(entry.handle);
+    }
+    m_entries = std::move(entries);
+    m_generation = m_header->generation;
+    return true;
+}
+
+native_contract CodeCache::find(const CacheKey& key) noexcept
+{
+    std::lock_guard lock{m_mutex};
+    const IndexLock index_lock{m_index_fd};
+    if (!refresh(nullptr))
+        return nullptr;
+
+    const auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        return nullptr;
+
+    auto& entry = it->second;
+    if (entry.fn == nullptr)
+    {
+        // The first use: load the shared object. Broken objects are dropped from the cache.
+        auto* const handle = ::dlopen(object_path(key).c_str(), RTLD_NOW | RTLD_LOCAL);
+        if (handle == nullptr)
+        {
+            remove(key);
+            return nullptr;
+        }
+        const auto fn = reinterpret_cast<native_contract>(::dlsym(handle, cached_contract_entry));
+        if (fn == nullptr)
+        {
+            ::dlclose(handle);
+            remove(key);
+            return nullptr;
+        }
+        entry.handle = handle;
+        entry.fn = fn;
+    }
+
+    records()[entry.record].last_used = ++m_header->clock;
+    return entry.fn;
+}
+
+bool CodeCache::contains(const CacheKey& key) noexcept
+{
+    std::lock_guard lock{m_mutex};
+    const IndexLock index_lock{m_index_fd};
+    return refresh(nullptr) && m_entries.contains(key);
+}
+
+bool CodeCache::build(
+    evmc_revision rev, bytes_view code, const CompileOptions& options, std::string* error)
+{
+    const CacheKey key{rev, code, options};
+    if (contains(key))
+        return true;
+
+    // Temporary files are not ".so" so the open() of another process does not take them
+    // for orphans. mkstemps() reserves a name of its own for every build, also for the
+    // concurrent builds of the same contract in one process.
+    auto object_name = (m_dir / (object_path(key).stem().string() + ".XXXXXX.tmp")).string();
+    const auto fd = ::mkstemps(object_name.data(), 4);
+    if (fd < 0)
+    {
+        set_error(error, m_dir.string() + ": " + std::strerror(errno));
+        return false;
+    }
+    ::close(fd);
+    const fs::path object{object_name};
+    const auto unit = compile_translation_unit(rev, code, cached_contract_entry, options);
+    return build_shared_object(unit, object, options, error) && insert(key, object, error);
+}
+
+bool CodeCache::insert(const CacheKey& key, const fs::path& shared_object, std::string* error)
+{
+    std::lock_guard lock{m_mutex};
+    const IndexLock index_lock{m_index_fd};
+    std::error_code ec;
+    if (!refresh(error))
+    {
+        fs::remove(shared_object, ec);
+        return false;
+    }
+
+    // The same key always identifies the same native code so the existing entry
+    // (possibly inserted by another process) wins.
+    // This also prevents dlopen() from returning a stale handle for the replaced file.
+    if (m_entries.contains(key))
+    {
+        fs::remove(shared_object, ec);
+        return true;
+    }
+
+    if (m_header->count == m_header->capacity && !map_index(m_header->capacity * 2, error))
+        return false;
+
+    const auto path = object_path(key);
+    fs::rename(shared_object, path, ec);
+    if (ec)  // Possibly on another file system.
+    {
+        fs::copy_file(shared_object, path, fs::copy_options::overwrite_existing, ec);
+        if (ec)
+        {
+            set_error(error, path.string() + ": " + ec.message());
+            return false;
+        }
+        fs::remove(shared_object, ec);
+    }
+    const auto size = fs::file_size(path, ec);
+    if (ec)
+    {
+        set_error(error, path.string() + ": " + ec.message());
+        fs::remove(path, ec);
+        return false;
+    }
+
+    const auto index = m_header->count;
+    auto& rec = records()[index];
+    std::memcpy(rec.code_hash, key.code_hash.bytes, sizeof(rec.code_hash));
+    rec.rev = key.rev;
+    rec.options = key.options;
+    rec.abi = key.abi;
+    rec.reserved = 0;
+    rec.size = size;
+    rec.last_used = ++m_header->clock;
+    m_header->count = index + 1;
+    bump_generation();
+
+    m_entries[key] = {index, nullptr, nullptr};
+    m_total_size += rec.size;
+    evict();
+    return true;
+}
+
+uint64_t CodeCache::generation() const noexcept
+{
+    return std::atomic_ref{m_header_view->generation}.load(std::memory_order_acquire);
+}
+
+size_t CodeCache::size() noexcept
+{
+    std::lock_guard lock{m_mutex};
+    const IndexLock index_lock{m_index_fd};
+    refresh(nullptr);
+    return m_entries.size();
+}
+
+uint64_t CodeCache::total_size() noexcept
+{
+    std::lock_guard lock{m_mutex};
+    const IndexLock index_lock{m_index_fd};
+    refresh(nullptr);
+    return m_total_size;
+}
+
+void CodeCache::bump_generation() noexcept
+{
+    // Atomic for the readers of generation(), in this process and in the others.
+    m_generation =
+        std::atomic_ref{m_header->generation}.fetch_add(1, std::memory_order_release) + 1;
+}
+
+void CodeCache::remove(const CacheKey& key) noexcept
+{
+    if (const auto it = m_entries.find(key); it != m_entries.end())
+        remove_record(it->second.record);
+}
+
+void CodeCache::remove_record(size_t index) noexcept
+{
+    auto* const recs = records();
+    const auto key = recs[index].key();
+    if (const auto it = m_entries.find(key); it != m_entries.end())
+    {
+        // The entry point may still be in use: keep the object loaded.
+        if (it->second.handle != nullptr)
+            m_evicted_handles.push_back(it->second.handle);
+        m_entries.erase(it);
+    }
+
+    std::error_code ec;
+    fs::remove(object_path(key), ec);
+
+    // Fill the gap with the last record.
+    const auto last = m_header->count - 1;
+    m_total_size -= recs[index].size;
+    if (index != last)
+    {
+        recs[index] = recs[last];
+        if (const auto it = m_entries.find(recs[index].key()); it != m_entries.end())
+            it->second.record = index;
+    }
+    m_header->count = last;
+    bump_generation();
+}
+
+void CodeCache::evict() noexcept
+{
+    // Keep at least the most recently used entry, even if it exceeds the budget alone.
+    // Every iteration removes a record so this ends even if the index and the entries differ.
+    while (m_total_size > m_size_budget && m_header->count > 1)
+    {
+        const auto* const recs = records();
+        size_t lru = 0;
+        for (size_t i = 1; i < m_header->count; ++i)
+        {
+            if (recs[i].last_used < recs[lru].last_used)
+                lru = i;
+        }
+        remove_record(lru);
+    }
+}
+}  // namespace evmone
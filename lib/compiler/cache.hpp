@@ -0,0 +1,139 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "codegen.hpp"
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace evmone
+{
+/// The name of the entry point exported by the shared objects stored in the CodeCache,
+/// see compile_translation_unit().
+constexpr auto cached_contract_entry = "evmone_aot_entry";
+
+/// Returns the include directories of the generated code, given to the C++ compiler.
+std::vector<std::string> compiler_include_dirs();
+
+/// Identifies a compiled contract: the same code compiled for another revision, with
+/// other compile options or by another version of the compiler is a different native object.
+struct CacheKey
+{
+    /// The version of the generated code and of compiler-rt: the hash of their sources
+    /// computed by the build, so that the objects built by another version are never loaded.
+    static const uint32_t current_abi;
+
+    evmc::bytes32 code_hash;
+    evmc_revision rev = {};
+    uint32_t options = 0;  ///< CompileOptions::fingerprint().
+    uint32_t abi = current_abi;
+
+    CacheKey() = default;
+    CacheKey(evmc_revision rev_, bytes_view code, const CompileOptions& options_) noexcept;
+    CacheKey(const evmc::bytes32& code_hash_, evmc_revision rev_,
+        const CompileOptions& options_) noexcept
+      : code_hash{code_hash_}, rev{rev_}, options{options_.fingerprint()}
+    {}
+
+    friend bool operator==(const CacheKey&, const CacheKey&) noexcept = default;
+};
+
+/// Persistent, content-addressed cache of compiled contracts (shared objects).
+///
+/// The cache directory contains the shared objects and the memory-mapped index file
+/// recording the key, the size and the last use of every entry. Opening the cache only maps
+/// the index; a shared object is loaded with dlopen() on its first lookup. Whenever the total
+/// size of the shared objects exceeds the budget, the least recently used entries are evicted.
+///
+/// Loaded objects are never unloaded before the cache is destroyed so entry points returned
+/// by find() stay valid (even after the eviction of their entries).
+///
+/// The cache may be shared by several processes. Every access locks the index file (flock)
+/// and first reloads the index if another process has changed it since.
+class CodeCache
+{
+public:
+    /// Opens (or creates) the cache in the given directory.
+    /// Returns nullptr on failure and sets the error message.
+    static std::unique_ptr<CodeCache> open(
+        const std::filesystem::path& dir, uint64_t size_budget, std::string* error = nullptr);
+
+    ~CodeCache() noexcept;
+
+    CodeCache(const CodeCache&) = delete;
+    CodeCache& operator=(const CodeCache&) = delete;
+
+    /// Returns the entry point of the cached contract or nullptr if not cached.
+    native_contract find(const CacheKey& key) noexcept;
+
+    /// Returns true if the contract is cached (without loading it).
+    [[nodiscard]] bool contains(const CacheKey& key) noexcept;
+
+    /// Moves the shared object built from compile_translation_unit(..., cached_contract_entry)
+    /// into the cache. The object is loaded lazily by find().
+    /// Returns false on failure and sets the error message.
+    bool insert(const CacheKey& key, const std::filesystem::path& shared_object,
+        std::string* error = nullptr);
+
+    /// Generates the code of the contract, builds the shared object with the C++ compiler
+    /// evmone was built with and inserts it into the cache. Does nothing if already cached.
+    /// This runs an external process and may take seconds for large contracts.
+    /// Returns false on failure and sets the error message.
+    bool build(evmc_revision rev, bytes_view code, const CompileOptions& options,
+        std::string* error = nullptr);
+
+    /// Returns the number of cached entries.
+    [[nodiscard]] size_t size() noexcept;
+
+    /// Returns the total size of the cached shared objects in bytes.
+    [[nodiscard]] uint64_t total_size() noexcept;
+
+    /// Returns the generation of the index, which changes whenever entries are added or
+    /// removed (by any process). A contract missing from the cache is still missing as long
+    /// as the generation is the same. Takes no lock.
+    [[nodiscard]] uint64_t generation() const noexcept;
+
+private:
+    struct IndexHeader;
+    struct IndexRecord;
+
+    struct KeyHash
+    {
+        size_t operator()(const CacheKey& key) const noexcept;
+    };
+
+    struct Entry
+    {
+        size_t record = 0;            ///< Position in the index.
+        void* handle = nullptr;       ///< The dlopen() handle, nullptr until first use.
+        native_contract fn = nullptr;
+    };
+
+    std::filesystem::path m_dir;
+    uint64_t m_size_budget = 0;
+    int m_index_fd = -1;
+    IndexHeader* m_header = nullptr;  ///< The mapped index file.
+    IndexHeader* m_header_view = nullptr;  ///< The header mapped read-only, see generation().
+    size_t m_mapped_size = 0;
+    uint64_t m_generation = 0;  ///< The generation of the index m_entries was loaded from.
+    uint64_t m_total_size = 0;
+    std::unordered_map<CacheKey, Entry, KeyHash> m_entries;
+    std::vector<void*> m_evicted_handles;
+    std::mutex m_mutex;
+
+    CodeCache() = default;
+
+    [[nodiscard]] IndexRecord* records() const noexcept;
+    [[nodiscard]] std::filesystem::path object_path(const CacheKey& key) const;
+    bool map_index(uint64_t capacity, std::string* error) noexcept;
+    bool refresh(std::string* error) noexcept;
+    void bump_generation() noexcept;
+    void remove(const CacheKey& key) noexcept;
+    void remove_record(size_t index) noexcept;
+    void evict() noexcept;
+};
+}  // namespace evmone
@@ -0,0 +1,1157 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "codegen.hpp"
+#include "aot_compiler.hpp"
+#include <evmc/hex.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <iterator>
+#include <optional>
+
+namespace evmone
+{
+namespace
+{
+/// Record information about a basic block that are useful at compile time.
+struct BasicBlockAnalysis {
+    /// True iff. this basic block contains no OP_INVALID.
+    bool valid = true;
+
+    /// Starting offset of this basic block.
+    size_t start_offset;
+
+    /// Cost table for the opcodes.
+    const baseline::CostTable& cost_table;
+
+    /// Opcodes in this block.
+    std::vector<Opcode> opcodes {};
+
+    /// Immediate values in this basic block.
+    std::vector<std::optional<uint256>> imm_values {};
+
+    /// push_n_jump[i] is true if opcodes[i:i+2] has a "PUSH & JUMP" pattern.
+    std::vector<bool> push_n_jump;
+
+    /// Base gas costs of this basic block.
+    int64_t base_gas_cost {};
+
+    /// Minimum stack height required by this basic block (to avoid stack underflow).
+    int stack_required {};
+
+    /// Growth in stack height after executing this basic block (may be negative).
+    int stack_max_growth {};
+
+    explicit BasicBlockAnalysis(size_t offset, const baseline::CostTable& cost_table)
+        : start_offset(offset)
+        , cost_table(cost_table)
+    {}
+};
+
+/// Return the hex representation of a uint256.
+std::string hex(uint256 x)
+{
+    if (x == 0)
+        return "0";
+
+    auto s = std::string{};
+    while (x != 0)
+    {
+        const auto d = x % 16;
+        const auto c = d < 10 ? '0' + d : 'a' + d - 10;
+        s.push_back(char(c));
+        x >>= 4;
+    }
+    std::reverse(s.begin(), s.end());
+    return s;
+}
+
+/// Returns true if the execution may continue with the next block after this one.
+bool falls_through(const BasicBlockAnalysis& bb)
+{
+    switch (bb.opcodes.back())
+    {
+    case OP_STOP:
+    case OP_RETURN:
+    case OP_REVERT:
+    case OP_SELFDESTRUCT:
+    case OP_JUMP:
+        return false;
+    default:
+        return true;
+    }
+}
+
+/// Returns the index of the next valid block after every block (or the number of blocks).
+/// Invalid blocks are not generated so the execution falls through them.
+std::vector<size_t> next_valid_blocks(const std::vector<BasicBlockAnalysis>& blocks)
+{
+    std::vector<size_t> next(blocks.size());
+    auto n = blocks.size();
+    for (size_t b = blocks.size(); b-- > 0;) {
+        next[b] = n;
+        if (blocks[b].valid)
+            n = b;
+    }
+    return next;
+}
+
+/// Returns the index of the valid block starting with the JUMPDEST at the given offset.
+std::optional<size_t> find_jumpdest_block(
+    const std::vector<BasicBlockAnalysis>& blocks, const uint256& offset)
+{
+    const auto it = std::lower_bound(blocks.begin(), blocks.end(), offset,
+        [](const auto& blk, const uint256& ofs) { return blk.start_offset < ofs; });
+    if (it == blocks.end() || it->start_offset != offset || !it->valid ||
+        it->opcodes[0] != OP_JUMPDEST)
+        return std::nullopt;
+    return size_t(it - blocks.begin());
+}
+
+/// Returns the statically known successors of every block in the control flow graph:
+/// the next block of a block falling through and the target of PUSHnJUMP(I).
+std::vector<std::vector<size_t>> static_successors(
+    const std::vector<BasicBlockAnalysis>& blocks, const std::vector<size_t>& next)
+{
+    const auto n = blocks.size();
+    std::vector<std::vector<size_t>> successors(n);
+    for (size_t b = 0; b < n; ++b) {
+        const auto& bb = blocks[b];
+        if (!bb.valid)
+            continue;
+        if (falls_through(bb) && next[b] < n)
+            successors[b].push_back(next[b]);
+        const auto last = bb.opcodes.size() - 1;
+        if (last > 0 && bb.push_n_jump[last - 1] && bb.imm_values[last - 1]) {
+            if (const auto target = find_jumpdest_block(blocks, *bb.imm_values[last - 1]))
+                successors[b].push_back(*target);
+        }
+    }
+    return successors;
+}
+
+/// Returns the strongly connected components of the valid blocks in topological order.
+std::vector<std::vector<size_t>> strongly_connected_components(
+    const std::vector<BasicBlockAnalysis>& blocks,
+    const std::vector<std::vector<size_t>>& successors)
+{
+    // Tarjan's algorithm (iterative: large contracts have long chains of blocks).
+    // The components are found in reverse topological order.
+    const auto n = blocks.size();
+    std::vector<int> index(n, -1);
+    std::vector<int> lowlink(n, 0);
+    std::vector<bool> on_stack(n, false);
+    std::vector<size_t> stack;
+    std::vector<std::pair<size_t, size_t>> path;  // (block, the next successor to visit)
+    std::vector<std::vector<size_t>> components;
+    int counter = 0;
+    const auto visit = [&](size_t b) {
+        index[b] = lowlink[b] = counter++;
+        stack.push_back(b);
+        on_stack[b] = true;
+        path.emplace_back(b, 0);
+    };
+    for (size_t root = 0; root < n; ++root) {
+        if (!blocks[root].valid || index[root] != -1)
+            continue;
+        visit(root);
+        while (!path.empty()) {
+            const auto v = path.back().first;
+            if (const auto i = path.back().second++; i < successors[v].size()) {
+                const auto w = successors[v][i];
+                if (index[w] == -1)
+                    visit(w);
+                else if (on_stack[w])
+                    lowlink[v] = std::min(lowlink[v], index[w]);
+                continue;
+            }
+            path.pop_back();
+            if (!path.empty())
+                lowlink[path.back().first] = std::min(lowlink[path.back().first], lowlink[v]);
+            if (lowlink[v] == index[v]) {
+                auto& component = components.emplace_back();
+                size_t w = 0;
+                do {
+                    w = stack.back();
+                    stack.pop_back();
+                    on_stack[w] = false;
+                    component.push_back(w);
+                } while (w != v);
+            }
+        }
+    }
+    std::reverse(components.begin(), components.end());
+    return components;
+}
+
+/// Partitions the valid blocks into regions of at most max_size instructions
+/// and returns the region of every block (-1 for the invalid ones).
+///
+/// The strongly connected components (in topological order) are never split, so that loops
+/// stay within a region. Zero max_size puts all blocks in a single region.
+std::vector<int> partition_regions(const std::vector<BasicBlockAnalysis>& blocks,
+    const std::vector<std::vector<size_t>>& components, size_t max_size)
+{
+    std::vector<int> regions(blocks.size(), -1);
+    int region = 0;
+    size_t region_size = 0;
+    for (const auto& component : components) {
+        size_t size = 0;
+        for (const auto b : component)
+            size += blocks[b].opcodes.size();
+        if (max_size != 0 && region_size != 0 && region_size + size > max_size) {
+            ++region;
+            region_size = 0;
+        }
+        region_size += size;
+        for (const auto b : component)
+            regions[b] = region;
+    }
+    return regions;
+}
+
+/// The numbering of the jump targets of a contract shared by its functions (see JumpdestMap).
+struct JumpdestIndex
+{
+    std::string name;              ///< The name of the table.
+    std::string type;              ///< The type of the numbers: uint16_t, or uint32_t if needed.
+    std::vector<size_t> targets;   ///< The bytecode offsets of the targets in ascending order.
+};
+
+/// Appends the table numbering the targets from 1, indexed by the bytecode offset (0 for the
+/// other offsets). The table ends at the last target.
+void emit_jumpdest_index(std::string& out, const JumpdestIndex& index)
+{
+    const auto size = index.targets.empty() ? 0 : index.targets.back() + 1;
+    out += "static constexpr std::array<" + index.type + ", " + std::to_string(size) + "> " +
+           index.name + " {";
+    size_t next = 0;
+    for (size_t i = 0; i < index.targets.size(); ++i) {
+        for (; next < index.targets[i]; ++next)
+            out += "0,";
+        out += std::to_string(i + 1) + ",";
+        next = index.targets[i] + 1;
+    }
+    if (!index.targets.empty())
+        out.pop_back();
+    out += "};\n";
+}
+
+/// Appends the definition of the map of the given name from the bytecode offsets to the labels
+/// of the blocks: a static table of the labels indexed by the numbers of the targets (null for
+/// the number 0 and for the targets missing in `offsets`) and the JumpdestMap over it and the
+/// index. The offsets must be targets of the index in ascending order.
+void emit_jumpdest_map(std::string& out, std::string_view name, const JumpdestIndex& index,
+    const std::vector<size_t>& offsets)
+{
+    const auto labels = std::string{name} + "_labels";
+    out += "static constexpr std::array<native_jumpdest, " +
+           std::to_string(index.targets.size() + 1) + "> " + labels + " {nullptr";
+    auto it = offsets.begin();
+    for (const auto target : index.targets) {
+        if (it != offsets.end() && *it == target)
+            out += ",&&L_OFFSET_" + std::to_string(*it++);
+        else
+            out += ",nullptr";
+    }
+    out += "};\n";
+    out += "constexpr JumpdestMap<" + index.type + "> " + std::string{name} + " {" + index.name +
+           ".size(), " + index.name + ".data(), " + labels + ".data()};\n";
+}
+
+/// Appends the label and the requirements of the basic block.
+void emit_block_start(std::string& out, const BasicBlockAnalysis& bb)
+{
+    char buf[1024];
+    std::ignore = std::sprintf(buf, "\nBLOCK_START(%lu, %ld, %d, %d)\n",
+        bb.start_offset, bb.base_gas_cost, bb.stack_required, bb.stack_max_growth);
+    out += buf;
+}
+
+/// Returns the index of the first instruction of the jump ending the basic block
+/// (PUSHnJUMP(I) or JUMP(I)), or the number of instructions if there is none.
+size_t jump_begin(const BasicBlockAnalysis& bb)
+{
+    const auto size = bb.opcodes.size();
+    if (bb.opcodes.back() != OP_JUMP && bb.opcodes.back() != OP_JUMPI)
+        return size;
+    return (size >= 2 && bb.push_n_jump[size - 2]) ? size - 2 : size - 1;
+}
+
+/// The possible values of a stack item at compile time: a small set of constants,
+/// or any value (the empty set).
+struct ConstantSet
+{
+    /// The values in ascending order.
+    std::vector<uint256> values;
+
+    /// Joins the other set into this one: returns true if this set has changed.
+    /// A set of more than max_size values becomes any value.
+    bool join(const ConstantSet& other, size_t max_size)
+    {
+        if (values.empty())
+            return false;
+        std::vector<uint256> merged;
+        if (!other.values.empty()) {
+            std::set_union(values.begin(), values.end(), other.values.begin(),
+                other.values.end(), std::back_inserter(merged));
+        }
+        if (merged.size() > max_size)
+            merged.clear();
+        if (merged == values)
+            return false;
+        values = std::move(merged);
+        return true;
+    }
+};
+
+/// The stack at compile time: the items known at the top of the stack, from the deepest
+/// one to the top. The items below are any values.
+using AbstractStack = std::vector<ConstantSet>;
+
+/// Joins the other stack into this one: returns true if this stack has changed.
+bool join(AbstractStack& stack, const AbstractStack& other, size_t max_size)
+{
+    bool changed = false;
+    if (other.size() < stack.size()) {
+        stack.erase(stack.begin(), stack.end() - std::ptrdiff_t(other.size()));
+        changed = true;
+    }
+    const auto offset = other.size() - stack.size();
+    for (size_t i = 0; i < stack.size(); ++i)
+        changed |= stack[i].join(other[offset + i], max_size);
+    return changed;
+}
+
+/// Executes the instruction on the abstract stack. Only the constants pushed and moved by
+/// PUSH, DUP and SWAP are tracked, the results of the other instructions are any values.
+void abstract_execute(AbstractStack& stack, Opcode op, const std::optional<uint256>& imm)
+{
+    /// The maximum number of known items (DUP16 and SWAP16 reach the 17th item).
+    constexpr size_t max_depth = 32;
+
+    const auto at = [&stack](size_t depth) -> ConstantSet& {
+        if (stack.size() <= depth)
+            stack.insert(stack.begin(), depth + 1 - stack.size(), ConstantSet{});
+        return stack[stack.size() - 1 - depth];
+    };
+
+    if (op >= OP_PUSH0 && op <= OP_PUSH32) {
+        stack.push_back({{imm ? *imm : 0}});
+    } else if (op >= OP_DUP1 && op <= OP_DUP16) {
+        auto item = at(size_t(op - OP_DUP1));
+        stack.push_back(std::move(item));
+    } else if (op >= OP_SWAP1 && op <= OP_SWAP16) {
+        const auto n = size_t(op - OP_SWAP1 + 1);
+        std::ignore = at(n);
+        std::swap(at(0), at(n));
+    } else {
+        const auto& trait = instr::traits[op];
+        const auto num_inputs = size_t(trait.stack_height_required);
+        const auto num_outputs = size_t(trait.stack_height_required + trait.stack_height_change);
+        stack.resize(stack.size() - std::min(num_inputs, stack.size()));
+        stack.resize(stack.size() + num_outputs);
+    }
+
+    if (stack.size() > max_depth)
+        stack.erase(stack.begin(), stack.end() - std::ptrdiff_t(max_depth));
+}
+
+/// Resolves the targets of the dynamic jumps (JUMP(I) not preceded by PUSH) by abstract
+/// interpretation of the control flow graph, tracking the sets of at most max_targets
+/// constants the stack items may hold across the blocks. This finds e.g. the return addresses
+/// of Solidity's internal functions, pushed by the caller and moved by DUP and SWAP until
+/// the jump.
+///
+/// Returns for every block ending with a dynamic jump the blocks it may jump to, or none
+/// if a target is unknown or not a valid jump destination. Zero max_targets resolves nothing.
+std::vector<std::vector<size_t>> resolve_jumps(const std::vector<BasicBlockAnalysis>& blocks,
+    const std::vector<size_t>& next, size_t max_targets)
+{
+    const auto n = blocks.size();
+    std::vector<std::vector<size_t>> targets(n);
+    const auto first = size_t(std::find_if(blocks.begin(), blocks.end(),
+                                  [](const auto& bb) { return bb.valid; }) -
+                              blocks.begin());
+    if (max_targets == 0 || first == n)
+        return targets;
+
+    const auto is_dynamic_jump = [](const BasicBlockAnalysis& bb) {
+        const auto jump = jump_begin(bb);
+        return jump < bb.opcodes.size() && !bb.push_n_jump[jump];
+    };
+
+    // Executes the block up to its jump, if any.
+    const auto execute = [&blocks](size_t b, AbstractStack stack) {
+        const auto& bb = blocks[b];
+        auto end = bb.opcodes.size();
+        if (bb.opcodes.back() == OP_JUMP || bb.opcodes.back() == OP_JUMPI)
+            --end;
+        for (size_t i = 0; i < end; ++i)
+            abstract_execute(stack, bb.opcodes[i], bb.imm_values[i]);
+        return stack;
+    };
+
+    // The targets of the jumps whose targets are unknown.
+    std::vector<size_t> jumpdest_blocks;
+    for (size_t b = 0; b < n; ++b) {
+        if (blocks[b].valid && blocks[b].opcodes[0] == OP_JUMPDEST)
+            jumpdest_blocks.push_back(b);
+    }
+
+    // The stacks at the entries of the blocks (none for the blocks not reached yet).
+    std::vector<std::optional<AbstractStack>> entries(n);
+    std::vector<bool> queued(n, false);
+    std::vector<size_t> worklist;
+    const auto propagate = [&](size_t b, const AbstractStack& stack) {
+        if (b == n)
+            return;  // Past the end of the code: STOP.
+        const bool changed = !entries[b] || join(*entries[b], stack, max_targets);
+        if (!entries[b])
+            entries[b] = stack;
+        if (changed && !queued[b]) {
+            queued[b] = true;
+            worklist.push_back(b);
+        }
+    };
+
+    propagate(first, {});
+    while (!worklist.empty()) {
+        const auto b = worklist.back();
+        worklist.pop_back();
+        queued[b] = false;
+
+        const auto& bb = blocks[b];
+        auto stack = execute(b, *entries[b]);
+        const auto op = bb.opcodes.back();
+        if (op != OP_JUMP && op != OP_JUMPI) {
+            if (falls_through(bb))
+                propagate(next[b], stack);
+            continue;
+        }
+
+        const auto dst = stack.empty() ? ConstantSet{} : stack.back();
+        abstract_execute(stack, op, std::nullopt);
+        if (op == OP_JUMPI)
+            propagate(next[b], stack);
+        if (dst.values.empty()) {
+            for (const auto t : jumpdest_blocks)
+                propagate(t, stack);
+            continue;
+        }
+        for (const auto& value : dst.values) {
+            if (const auto t = find_jumpdest_block(blocks, value))
+                propagate(*t, stack);
+        }
+    }
+
+    for (size_t b = 0; b < n; ++b) {
+        if (!entries[b] || !is_dynamic_jump(blocks[b]))
+            continue;
+        const auto stack = execute(b, *entries[b]);
+        if (stack.empty() || stack.back().values.empty())
+            continue;
+        for (const auto& value : stack.back().values) {
+            const auto t = find_jumpdest_block(blocks, value);
+            if (!t) {
+                targets[b].clear();  // Leave the bad jump to the generic JUMP(I).
+                break;
+            }
+            targets[b].push_back(*t);
+        }
+    }
+    return targets;
+}
+
+/// Appends the jump ending the block to its resolved targets (see resolve_jumps):
+/// a direct jump to a single target, a switch otherwise.
+void emit_resolved_jump(std::string& out, const std::vector<BasicBlockAnalysis>& blocks,
+    Opcode op, const std::vector<size_t>& targets)
+{
+    const std::string kind = op == OP_JUMP ? "JUMP" : "JUMPI";
+    if (targets.size() == 1) {
+        out += kind + "_TO(" + std::to_string(blocks[targets[0]].start_offset) + ")\n";
+        return;
+    }
+    out += kind + "_SWITCH\n";
+    for (const auto t : targets)
+        out += "JUMP_CASE(" + std::to_string(blocks[t].start_offset) + ")\n";
+    out += kind + "_SWITCH_END\n";
+}
+
+/// Returns true if the instruction only operates on the stack and can be promoted
+/// to the operations on local variables (see VirtualStack).
+bool is_promotable(Opcode op)
+{
+    switch (op)
+    {
+    case OP_ADD:
+    case OP_MUL:
+    case OP_SUB:
+    case OP_DIV:
+    case OP_SDIV:
+    case OP_MOD:
+    case OP_SMOD:
+    case OP_LT:
+    case OP_GT:
+    case OP_SLT:
+    case OP_SGT:
+    case OP_EQ:
+    case OP_ISZERO:
+    case OP_AND:
+    case OP_OR:
+    case OP_XOR:
+    case OP_NOT:
+    case OP_BYTE:
+    case OP_SHL:
+    case OP_SHR:
+    case OP_SAR:
+    case OP_POP:
+        return true;
+    default:
+        return (op >= OP_PUSH0 && op <= OP_PUSH32) || (op >= OP_DUP1 && op <= OP_SWAP16);
+    }
+}
+
+/// The EVM stack during a run of promoted instructions within a C++ scope.
+///
+/// The items are local variables (or literals): the items of the real stack are loaded
+/// on first use and the real stack is only updated by flush(), which must be called before
+/// any instruction using the real stack. BLOCK_START has already checked the stack height
+/// required by the whole basic block so the loads are always valid.
+///
+/// The virtual stack does not outlive the run: it is flushed before the jumps and at the end of
+/// the block. Carrying it across the fall-through and static jump edges would need the same
+/// layout of the items at every entry of the target block (from all its predecessors, from the
+/// dynamic jumps and from the region trampolines), so the stores and loads at the block
+/// boundaries are left to the C++ compiler, which sees the adjacent blocks of a function.
+class VirtualStack
+{
+    std::string& m_out;
+
+    /// The items from the deepest loaded one to the top.
+    std::vector<std::string> m_items;
+
+    /// The real stack index of the loaded items (-1 for the computed ones).
+    std::vector<int> m_origins;
+
+    int m_num_loaded = 0;
+    int m_num_temps = 0;
+
+    /// Makes the item at the given depth (0 for the top) available.
+    void load(size_t depth)
+    {
+        while (m_items.size() <= depth) {
+            const auto name = "s" + std::to_string(m_num_loaded);
+            m_out += "const uint256 " + name + " = stack[" + std::to_string(m_num_loaded) + "];\n";
+            m_items.insert(m_items.begin(), name);
+            m_origins.insert(m_origins.begin(), m_num_loaded);
+            ++m_num_loaded;
+        }
+    }
+
+public:
+    explicit VirtualStack(std::string& out) : m_out{out} {}
+
+    /// Returns the item at the given depth.
+    const std::string& operator[](size_t depth)
+    {
+        load(depth);
+        return m_items[m_items.size() - 1 - depth];
+    }
+
+    std::string pop()
+    {
+        load(0);
+        auto item = std::move(m_items.back());
+        m_items.pop_back();
+        m_origins.pop_back();
+        return item;
+    }
+
+    /// Pushes an existing item or a literal.
+    void push(std::string item, int origin = -1)
+    {
+        m_items.push_back(std::move(item));
+        m_origins.push_back(origin);
+    }
+
+    /// Pushes the value of the expression, computed into a new local variable.
+    void push_computed(const std::string& expr)
+    {
+        const auto name = "t" + std::to_string(m_num_temps++);
+        m_out += "const uint256 " + name + " = " + expr + ";\n";
+        push(name);
+    }
+
+    void dup(size_t n)
+    {
+        load(n - 1);
+        const auto i = m_items.size() - n;
+        push(m_items[i], m_origins[i]);
+    }
+
+    void swap(size_t n)
+    {
+        load(n);
+        const auto top = m_items.size() - 1;
+        std::swap(m_items[top], m_items[top - n]);
+        std::swap(m_origins[top], m_origins[top - n]);
+    }
+
+    /// Writes the items back to the real stack. The deepest items still in their original
+    /// places are not written.
+    void flush()
+    {
+        size_t in_place = 0;
+        while (in_place < m_items.size() &&
+               m_origins[in_place] == m_num_loaded - 1 - int(in_place))
+            ++in_place;
+        if (const auto num_dropped = m_num_loaded - int(in_place); num_dropped != 0)
+            m_out += "stack.drop(" + std::to_string(num_dropped) + ");\n";
+        for (size_t i = in_place; i < m_items.size(); ++i)
+            m_out += "stack.push(" + m_items[i] + ");\n";
+    }
+};
+
+/// Appends the code of a run of promotable instructions [begin, end) of the basic block.
+void emit_promoted_instructions(
+    std::string& out, const BasicBlockAnalysis& bb, size_t begin, size_t end)
+{
+    out += "{\n";
+    VirtualStack stack{out};
+    for (size_t i = begin; i < end; ++i) {
+        const auto op = bb.opcodes[i];
+        if (op >= OP_PUSH0 && op <= OP_PUSH32) {
+            stack.push("0x" + hex(bb.imm_values[i] ? *bb.imm_values[i] : 0) + "_u256");
+        } else if (op >= OP_DUP1 && op <= OP_DUP16) {
+            stack.dup(size_t(op - OP_DUP1 + 1));
+        } else if (op >= OP_SWAP1 && op <= OP_SWAP16) {
+            stack.swap(size_t(op - OP_SWAP1 + 1));
+        } else if (op == OP_POP) {
+            std::ignore = stack.pop();
+        } else if (op == OP_ISZERO) {
+            stack.push_computed("uint256(" + stack.pop() + " == 0)");
+        } else if (op == OP_NOT) {
+            stack.push_computed("~" + stack.pop());
+        } else {
+            // The binary instructions, as in the handlers of aot_instructions.hpp:
+            // a is the top item, b is the next one.
+            const auto a = stack.pop();
+            const auto b = stack.pop();
+            switch (op)
+            {
+            case OP_ADD:
+                stack.push_computed(a + " + " + b);
+                break;
+            case OP_MUL:
+                stack.push_computed(a + " * " + b);
+                break;
+            case OP_SUB:
+                stack.push_computed(a + " - " + b);
+                break;
+            case OP_DIV:
+                stack.push_computed(b + " != 0 ? intx::udivrem(" + a + ", " + b + ").quot : 0");
+                break;
+            case OP_SDIV:
+                stack.push_computed(b + " != 0 ? intx::sdivrem(" + a + ", " + b + ").quot : 0");
+                break;
+            case OP_MOD:
+                stack.push_computed(b + " != 0 ? intx::udivrem(" + a + ", " + b + ").rem : 0");
+                break;
+            case OP_SMOD:
+                stack.push_computed(b + " != 0 ? intx::sdivrem(" + a + ", " + b + ").rem : 0");
+                break;
+            case OP_LT:
+                stack.push_computed("uint256(" + a + " < " + b + ")");
+                break;
+            case OP_GT:
+                stack.push_computed("uint256(" + b + " < " + a + ")");
+                break;
+            case OP_SLT:
+                stack.push_computed("uint256(int256(" + a + ") < int256(" + b + "))");
+                break;
+            case OP_SGT:
+                stack.push_computed("uint256(int256(" + b + ") < int256(" + a + "))");
+                break;
+            case OP_EQ:
+                stack.push_computed("uint256(" + a + " == " + b + ")");
+                break;
+            case OP_AND:
+                stack.push_computed(a + " & " + b);
+                break;
+            case OP_OR:
+                stack.push_computed(a + " | " + b);
+                break;
+            case OP_XOR:
+                stack.push_computed(a + " ^ " + b);
+                break;
+            case OP_SHL:
+                stack.push_computed(b + " << " + a);
+                break;
+            case OP_SHR:
+                stack.push_computed(b + " >> " + a);
+                break;
+            case OP_BYTE:
+                stack.push_computed("instr::core::byte_value(" + a + ", " + b + ")");
+                break;
+            case OP_SAR:
+                stack.push_computed("instr::core::sar_value(" + a + ", " + b + ")");
+                break;
+            default:
+                assert(false);
+            }
+        }
+    }
+    stack.flush();
+    out += "}\n";
+}
+
+/// Appends the code of the instructions [begin, end) of the basic block.
+/// With `promote`, the runs of promotable instructions operate on local variables.
+void emit_instructions(
+    std::string& out, const BasicBlockAnalysis& bb, size_t begin, size_t end, bool promote)
+{
+    char buf[1024];
+    for (size_t i = begin; i < end; ++i) {
+        if (promote) {
+            auto run_end = i;
+            while (run_end < end && !bb.push_n_jump[run_end] &&
+                   is_promotable(bb.opcodes[run_end]))
+                ++run_end;
+            if (run_end - i >= 2) {
+                emit_promoted_instructions(out, bb, i, run_end);
+                i = run_end - 1;
+                continue;
+            }
+        }
+
+        uint256 imm;
+        if (bb.push_n_jump[i]) {
+            imm = bb.imm_values[i] ? *bb.imm_values[i] : 0;
+            assert(imm == uint64_t(imm));
+            std::ignore = std::sprintf(buf, "PUSHn%s(%lu)\n",
+                instr::traits[bb.opcodes[i + 1]].name, uint64_t(imm));
+            ++i;
+        } else {
+            const auto opcode = bb.opcodes[i];
+            auto sz = std::sprintf(buf, "INVOKE(%s", instr::traits[opcode].name);
+            if (bb.imm_values[i]) {
+                imm = *bb.imm_values[i];
+                sz += std::sprintf(buf + sz, ", 0x%s_u256", hex(imm).c_str());
+            } else if (opcode == OP_JUMP || opcode == OP_JUMPI) {
+                sz += std::sprintf(buf + sz, ", jumpdest_map");
+            }
+            std::ignore = std::sprintf(buf + sz, ")\n");
+        }
+        out += buf;
+    }
+}
+
+/// Appends the explicit jump to the next block of a block falling through
+/// (where the next block does not follow it).
+void emit_fallthrough(std::string& out, const std::vector<BasicBlockAnalysis>& blocks, size_t next)
+{
+    if (next == blocks.size()) {
+        out += "goto label_final;\n";  // Past the end of the code: STOP.
+        return;
+    }
+    out += "goto L_OFFSET_" + std::to_string(blocks[next].start_offset) + ";\n";
+}
+
+/// Finds the loops to rotate: returns the header of the loop for every latch block.
+///
+/// A latch ends with PUSHnJUMP back (to a lower offset, within its strongly connected
+/// component) to a small header block ending with PUSHnJUMPI: the loop test. Such a jump is
+/// replaced by a copy of the header, so the back edge becomes the conditional jump and the
+/// loop test is done at the bottom of the loop, as in
+///
+///     while (cond) { body }   =>   if (cond) { do { body } while (cond); }
+std::vector<std::optional<size_t>> find_rotated_loops(const std::vector<BasicBlockAnalysis>& blocks,
+    const std::vector<size_t>& next, const std::vector<std::vector<size_t>>& successors,
+    const std::vector<std::vector<size_t>>& components)
+{
+    /// The maximum number of instructions of a duplicated header.
+    constexpr size_t max_header_size = 16;
+
+    const auto ends_with_push_n = [](const BasicBlockAnalysis& bb, Opcode jump) {
+        const auto size = bb.opcodes.size();
+        return size >= 2 && bb.opcodes[size - 1] == jump && bb.push_n_jump[size - 2];
+    };
+
+    std::vector<size_t> component_of(blocks.size());
+    for (size_t c = 0; c < components.size(); ++c) {
+        for (const auto b : components[c])
+            component_of[b] = c;
+    }
+
+    std::vector<std::optional<size_t>> rotated(blocks.size());
+    for (size_t b = 0; b < blocks.size(); ++b) {
+        if (!blocks[b].valid || !ends_with_push_n(blocks[b], OP_JUMP) || successors[b].empty())
+            continue;
+        const auto h = successors[b][0];
+        const auto& header = blocks[h];
+        if (component_of[h] == component_of[b] && header.start_offset <= blocks[b].start_offset &&
+            ends_with_push_n(header, OP_JUMPI) && header.opcodes.size() <= max_header_size &&
+            next[h] < blocks.size())
+            rotated[b] = h;
+    }
+    return rotated;
+}
+
+/// Places the gas checks of GAS_CHECK_LOC 3: returns for every block whether the gas
+/// is checked at its end (before its jump).
+///
+/// Every cycle of the execution must contain a check, so that the execution terminates:
+/// - the blocks ending with an unresolved dynamic jump are checked (it may go back anywhere),
+/// - the sources of the back edges of the static control flow graph are checked.
+/// The remaining static edges form a DAG in which the base gas used since the last check is
+/// then bounded: a block where the longest unchecked path would use more than the budget
+/// is checked too.
+std::vector<bool> place_gas_checks(const std::vector<BasicBlockAnalysis>& blocks,
+    const std::vector<std::vector<size_t>>& successors,
+    const std::vector<std::vector<size_t>>& jump_targets, int64_t budget)
+{
+    const auto n = blocks.size();
+    std::vector<bool> checked(n, false);
+
+    // Depth-first search of the static CFG: finds the back edges and the reverse postorder.
+    enum class Visit : uint8_t { no, active, done };
+    std::vector<Visit> visit(n, Visit::no);
+    std::vector<size_t> order;  // Postorder.
+    std::vector<std::pair<size_t, size_t>> path;  // (block, the next successor to visit)
+    for (size_t root = 0; root < n; ++root) {
+        if (!blocks[root].valid || visit[root] != Visit::no)
+            continue;
+        visit[root] = Visit::active;
+        path.emplace_back(root, 0);
+        while (!path.empty()) {
+            const auto v = path.back().first;
+            if (const auto i = path.back().second++; i < successors[v].size()) {
+                const auto w = successors[v][i];
+                if (visit[w] == Visit::active)
+                    checked[v] = true;  // A back edge.
+                else if (visit[w] == Visit::no) {
+                    visit[w] = Visit::active;
+                    path.emplace_back(w, 0);
+                }
+                continue;
+            }
+            visit[v] = Visit::done;
+            order.push_back(v);
+            path.pop_back();
+        }
+    }
+    std::reverse(order.begin(), order.end());
+
+    std::vector<size_t> position(n);
+    for (size_t i = 0; i < order.size(); ++i)
+        position[order[i]] = i;
+
+    // The longest unchecked path ending at every block, in topological order of the DAG.
+    std::vector<int64_t> gas_in(n, 0);
+    for (const auto b : order) {
+        const auto& bb = blocks[b];
+        const auto jump = jump_begin(bb);
+        const auto dynamic_jump =
+            jump < bb.opcodes.size() && !bb.push_n_jump[jump] && jump_targets[b].empty();
+        if (dynamic_jump)
+            checked[b] = true;
+
+        auto gas_out = gas_in[b] + bb.base_gas_cost;
+        if (gas_out > budget && !successors[b].empty())
+            checked[b] = true;
+        if (checked[b])
+            gas_out = 0;
+        for (const auto w : successors[b]) {
+            if (position[w] > position[b])
+                gas_in[w] = std::max(gas_in[w], gas_out);
+        }
+    }
+    return checked;
+}
+
+/// Returns the name of the evmc_revision enumerator, e.g. EVMC_TANGERINE_WHISTLE.
+std::string revision_identifier(evmc_revision rev)
+{
+    std::string id = "EVMC_";
+    for (const auto c : std::string_view{evmc_revision_to_string(rev)})
+        id += (c == ' ') ? '_' : char(std::toupper(static_cast<unsigned char>(c)));
+    return id;
+}
+}  // namespace
+
+std::string contract_name(bytes_view code)
+{
+    return "contract_0x" + hex(intx::load_be256(ethash::keccak256(code.data(), code.size())));
+}
+
+std::string compile_cxx(const evmc_revision rev, bytes_view code, const CompileOptions& options)
+{
+    const baseline::CostTable& cost_table =
+        baseline::get_baseline_cost_table(rev, 0 /* legacy format: no RJUMP/DATALOADN/... */);
+
+    std::vector<BasicBlockAnalysis> basic_blks;
+    std::vector<size_t> jumpdests;
+
+    bool create_new_bb = true;
+    for (size_t i = 0; i < code.size(); ++i) {
+        // Create a new basic block if (at least) one of the following is true:
+        // - The previous opcode is STOP, RETURN, REVERT, SELFDESTRUCT, or JUMP(I)
+        // - The current opcode is JUMPDEST
+        const auto opcode = Opcode(code[i]);
+        if (opcode == OP_JUMPDEST) {
+            create_new_bb = true;
+            jumpdests.push_back(i);
+        }
+        if (create_new_bb) {
+            basic_blks.emplace_back(i, cost_table);
+            create_new_bb = false;
+        }
+
+        // Grow the current basic block.
+        auto& bb = basic_blks.back();
+        auto trait = instr::traits[opcode];
+        bb.opcodes.push_back(Opcode(opcode));
+        if (trait.immediate_size > 0) {
+            uint256 imm = 0;
+            for (size_t k = i + 1; k <= i + trait.immediate_size; ++k)
+                imm = imm << 8 | code[k];
+            bb.imm_values.emplace_back(imm);
+            i += trait.immediate_size;
+        } else {
+            bb.imm_values.emplace_back();
+        }
+
+        // Time to close the current basic block?
+        switch (opcode)
+        {
+        case OP_STOP:
+        case OP_RETURN:
+        case OP_REVERT:
+        case OP_SELFDESTRUCT:
+        case OP_JUMP:
+        case OP_JUMPI:
+            create_new_bb = true;
+            break;
+        default:
+            break;
+        }
+    }
+
+    // Compute the summary of every basic block.
+    for (auto& bb : basic_blks) {
+        int stack_change = 0;
+        bb.push_n_jump.assign(bb.opcodes.size(), false);
+        for (size_t i = 0; i < bb.opcodes.size(); ++i) {
+            const auto op = bb.opcodes[i];
+            bb.base_gas_cost += cost_table[op];
+            auto current_stack_required =
+                instr::traits[op].stack_height_required - stack_change;
+            bb.stack_required = std::max(bb.stack_required, current_stack_required);
+            stack_change += instr::traits[op].stack_height_change;
+            bb.stack_max_growth = std::max(bb.stack_max_growth, stack_change);
+            bb.valid &= (op != OP_INVALID);
+
+            if ((op == OP_JUMP || op == OP_JUMPI) && (i > 0)) {
+                const auto prev_op = bb.opcodes[i - 1];
+                bb.push_n_jump[i - 1] = (prev_op >= OP_PUSH0 && prev_op <= OP_PUSH32);
+            }
+        }
+    }
+
+    std::string compiled;
+    compiled += "/*\n  EVM revision: " + std::string(evmc_revision_to_string(rev)) +
+                "\n  contract hex code: " + evmc::hex(code) + "\n*/\n";
+
+    const auto name = contract_name(code);
+    const auto rev_id = revision_identifier(rev);
+    const auto next = next_valid_blocks(basic_blks);
+    const auto jump_targets = resolve_jumps(basic_blks, next, options.max_jump_targets);
+    auto successors = static_successors(basic_blks, next);
+    for (size_t b = 0; b < basic_blks.size(); ++b) {
+        for (const auto t : jump_targets[b]) {
+            if (std::find(successors[b].begin(), successors[b].end(), t) == successors[b].end())
+                successors[b].push_back(t);
+        }
+    }
+    const auto components = strongly_connected_components(basic_blks, successors);
+    const auto regions = partition_regions(basic_blks, components, options.max_region_size);
+    const auto num_regions =
+        regions.empty() ? 0 : size_t(*std::max_element(regions.begin(), regions.end()) + 1);
+
+    // The rotation of loops relies on PUSHnJUMP (the jump to the header is static).
+    const auto rotated = (options.rotate_loops && options.push_n_jump) ?
+                             find_rotated_loops(basic_blks, next, successors, components) :
+                             std::vector<std::optional<size_t>>(basic_blks.size());
+
+    // GAS_CHECK_LOC 3: the compiler decides where to check the gas.
+    const auto gas_checked =
+        (options.gas_check_loc == 3) ?
+            place_gas_checks(basic_blks, successors, jump_targets, options.gas_check_budget) :
+            std::vector<bool>(basic_blks.size(), false);
+
+    // Appends the code of the block without the label, with the gas check before the jump.
+    const auto emit_code = [&](size_t b, size_t end) {
+        const auto& bb = basic_blks[b];
+        const auto jump = std::min(jump_begin(bb), end);
+        emit_instructions(compiled, bb, 0, jump, options.promote_stack);
+        if (gas_checked[b])
+            compiled += "GAS_CHECK\n";
+        if (end == bb.opcodes.size() && !jump_targets[b].empty())
+            emit_resolved_jump(compiled, basic_blks, bb.opcodes.back(), jump_targets[b]);
+        else
+            emit_instructions(compiled, bb, jump, end, options.promote_stack);
+    };
+
+    // Appends the code of the block, with the copy of the loop header at a latch.
+    // Marks the blocks of other regions the code continues at.
+    const auto emit_block = [&](size_t b, std::vector<bool>& exits) {
+        const auto& bb = basic_blks[b];
+        emit_block_start(compiled, bb);
+        if (!rotated[b]) {
+            emit_code(b, bb.opcodes.size());
+            return;
+        }
+        const auto h = *rotated[b];
+        emit_code(b, bb.opcodes.size() - 2);
+        compiled += "LOOP_ROTATE(" + std::to_string(basic_blks[h].start_offset) + ")\n";
+        emit_code(h, basic_blks[h].opcodes.size());
+        emit_fallthrough(compiled, basic_blks, next[h]);
+        if (next[h] < basic_blks.size() && regions[next[h]] != regions[b])
+            exits[next[h]] = true;
+    };
+
+    // The numbers of the jump targets: the JUMPDESTs, and the other blocks the regions are
+    // entered at (see below).
+    const auto index_type = [](size_t num_targets) {
+        return num_targets > 0xffff ? "uint32_t" : "uint16_t";
+    };
+    JumpdestIndex index{name + "_jumpdest_index", index_type(jumpdests.size()), jumpdests};
+
+    if (num_regions <= 1) {
+        // Generate the C++ code snippet: the whole contract in a single function.
+        emit_jumpdest_index(compiled, index);
+        compiled += "evmc_result " + name + "(ExecutionState& state)\n{\n";
+        compiled += "PROLOGUE(" + rev_id + ")\n";
+        emit_jumpdest_map(compiled, "jumpdest_map", index, jumpdests);
+        std::vector<bool> exits(basic_blks.size(), false);
+        for (size_t b = 0; b < basic_blks.size(); ++b) {
+            if (basic_blks[b].valid)
+                emit_block(b, exits);
+        }
+        compiled += "\nEPILOGUE\n";
+        compiled += "}\n";
+        return compiled;
+    }
+
+    // The contract is split: every region is a function entered at one of its blocks
+    // (region_entries) and left at the code of another region (REGION_EXIT stubs labeled
+    // after the blocks of other regions, so that jumps are generated as usual).
+    const auto first = size_t(std::find_if(basic_blks.begin(), basic_blks.end(),
+                                  [](const auto& bb) { return bb.valid; }) -
+                              basic_blks.begin());
+    std::vector<bool> is_entry(basic_blks.size(), false);
+    is_entry[first] = true;
+    for (size_t b = 0; b < basic_blks.size(); ++b) {
+        if (!basic_blks[b].valid)
+            continue;
+        is_entry[b] = is_entry[b] || basic_blks[b].opcodes[0] == OP_JUMPDEST;
+        // A copy of a rotated loop header is in the region of the header.
+        if (falls_through(basic_blks[b]) && next[b] < basic_blks.size() &&
+            regions[next[b]] != regions[b])
+            is_entry[next[b]] = true;
+    }
+    std::vector<std::vector<size_t>> entries(num_regions);
+    for (size_t b = 0; b < basic_blks.size(); ++b) {
+        if (is_entry[b])
+            entries[size_t(regions[b])].push_back(basic_blks[b].start_offset);
+    }
+    index.targets.clear();
+    for (size_t b = 0; b < basic_blks.size(); ++b) {
+        const auto offset = basic_blks[b].start_offset;
+        if (is_entry[b] || std::binary_search(jumpdests.begin(), jumpdests.end(), offset))
+            index.targets.push_back(offset);
+    }
+    index.type = index_type(index.targets.size());
+    emit_jumpdest_index(compiled, index);
+
+    for (size_t r = 0; r < num_regions; ++r) {
+        compiled += "[[gnu::noinline]] static void " + name + "_region_" + std::to_string(r) +
+                    "(ExecutionState& state, RegionContext& region)\n{\n";
+        compiled += "REGION_PROLOGUE(" + rev_id + ")\n";
+        emit_jumpdest_map(compiled, "jumpdest_map", index, jumpdests);
+        emit_jumpdest_map(compiled, "region_entries", index, entries[r]);
+        compiled += "REGION_ENTER\n";
+
+        std::vector<bool> exits(basic_blks.size(), false);
+        std::optional<size_t> prev;
+        for (size_t b = 0; b < basic_blks.size(); ++b) {
+            if (!basic_blks[b].valid)
+                continue;
+            if (regions[b] != int(r)) {
+                exits[b] = exits[b] || basic_blks[b].opcodes[0] == OP_JUMPDEST;
+                continue;
+            }
+            // Blocks falling through to a block that does not follow them here (i.e. a block
+            // of another region) jump to it.
+            if (prev && falls_through(basic_blks[*prev]) && next[*prev] != b) {
+                emit_fallthrough(compiled, basic_blks, next[*prev]);
+                exits[next[*prev]] = true;
+            }
+            emit_block(b, exits);
+            prev = b;
+        }
+        if (prev && falls_through(basic_blks[*prev])) {
+            emit_fallthrough(compiled, basic_blks, next[*prev]);
+            if (next[*prev] < basic_blks.size())
+                exits[next[*prev]] = true;
+        }
+
+        compiled += "\n";
+        for (size_t b = 0; b < basic_blks.size(); ++b) {
+            if (exits[b])
+                compiled += "REGION_EXIT(" + std::to_string(basic_blks[b].start_offset) + ")\n";
+        }
+        compiled += "REGION_EPILOGUE\n";
+        compiled += "}\n\n";
+    }
+
+    compiled += "evmc_result " + name + "(ExecutionState& state)\n{\n";
+    compiled += "REGION_TRAMPOLINE_BEGIN(" + std::to_string(basic_blks[first].start_offset) +
+                ")\n";
+    for (size_t r = 0; r < num_regions; ++r) {
+        for (const auto offset : entries[r])
+            compiled += "REGION_CASE(" + std::to_string(offset) + ")\n";
+        compiled += "REGION_CALL(" + name + "_region_" + std::to_string(r) + ")\n";
+    }
+    compiled += "REGION_TRAMPOLINE_END\n";
+    compiled += "}\n";
+    return compiled;
+}
+
+std::string compile_translation_unit(evmc_revision rev, bytes_view code,
+    std::string_view entry_name, const CompileOptions& options)
+{
+    auto unit = std::string{"#include \"aot_compiler.hpp\"\n"};
+
+    // The code depends on the configuration of the macros (e.g. the gas checks are placed for
+    // GAS_CHECK_LOC 3 only): refuse to build it with other definitions than the options'.
+    const auto assert_defined = [&unit](std::string_view macro, int value) {
+        const auto expected = std::string{macro} + " == " + std::to_string(value);
+        unit += "static_assert(" + expected + ", \"compiled for " + expected + "\");\n";
+    };
+    assert_defined("ENABLE_PUSHnJUMP", options.push_n_jump);
+    assert_defined("GAS_CHECK_LOC", options.gas_check_loc);
+    assert_defined("GAS_CHECK_OFF", options.gas_check_off);
+
+    unit += "using namespace evmone;\nnamespace {\n";
+    unit += compile_cxx(rev, code, options);
+    unit += "}\nextern \"C\" EVMC_EXPORT evmc_result ";
+    unit += entry_name;
+    unit += "(ExecutionState& state) { return " + contract_name(code) + "(state); }\n";
+    return unit;
+}
+}  // namespace evmone
@@ -0,0 +1,98 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "aot_execution_state.hpp"
+#include <initializer_list>
+
+namespace evmone
+{
+/// Configuration of the C++ compiler building the generated code.
+///
+/// The first fields mirror the optimization macros of aot_compiler.hpp.
+struct CompileOptions
+{
+    /// ENABLE_PUSHnJUMP.
+    bool push_n_jump = true;
+
+    /// GAS_CHECK_LOC.
+    int gas_check_loc = 1;
+
+    /// GAS_CHECK_OFF.
+    bool gas_check_off = false;
+
+    /// Rotate loops: replace the jump back to the loop test by a copy of the test,
+    /// see find_rotated_loops() in codegen.cpp.
+    bool rotate_loops = true;
+
+    /// Translate the runs of pure stack instructions (PUSH, DUP, SWAP, arithmetic, ...)
+    /// to operations on local variables instead of the EVM stack in memory.
+    bool promote_stack = true;
+
+    /// The maximum number of possible targets of a dynamic jump to resolve at compile time
+    /// (by tracking the constants on the stack); 0 disables the resolution.
+    size_t max_jump_targets = 4;
+
+    /// The optimization level of the C++ compiler (-O<n>).
+    int opt_level = 2;
+
+    /// Contracts with more instructions are split into multiple functions of about
+    /// this size (see compile_cxx()). Zero disables the splitting.
+    size_t max_region_size = 2000;
+
+    /// GAS_CHECK_LOC 3: the maximum base gas used between the gas checks placed by
+    /// the compiler (except within a single basic block).
+    int64_t gas_check_budget = 1000;
+
+    /// Returns a compact encoding of the options affecting the generated native code.
+    [[nodiscard]] uint32_t fingerprint() const noexcept
+    {
+        // FNV-1a of the fields.
+        uint32_t h = 2166136261;
+        for (const auto field : {uint64_t{push_n_jump}, uint64_t(gas_check_loc),
+                 uint64_t{gas_check_off}, uint64_t{rotate_loops}, uint64_t{promote_stack},
+                 uint64_t{max_jump_targets}, uint64_t(opt_level), uint64_t{max_region_size},
+                 uint64_t(gas_check_budget)})
+        {
+            for (size_t i = 0; i < sizeof(field); ++i)
+                h = (h ^ uint8_t(field >> (8 * i))) * 16777619;
+        }
+        return h;
+    }
+
+    /// Returns the preprocessor definitions (-D...) selecting this configuration.
+    [[nodiscard]] std::vector<std::string> definitions() const
+    {
+        return {"-DENABLE_PUSHnJUMP=" + std::to_string(int{push_n_jump}),
+            "-DGAS_CHECK_LOC=" + std::to_string(gas_check_loc),
+            "-DGAS_CHECK_OFF=" + std::to_string(int{gas_check_off})};
+    }
+};
+
+/// Returns the name of the C++ function generated for the given contract code,
+/// i.e. "contract_0x" followed by the keccak256 hash of the code.
+std::string contract_name(bytes_view code);
+
+/// Translates the EVM bytecode into a C++ function
+///
+///     evmc_result contract_0x<keccak256(code)>(ExecutionState& state)
+///
+/// built from the macros in aot_compiler.hpp and the compiler-rt opcode handlers.
+///
+/// Large contracts are split into regions of at most options.max_region_size instructions
+/// (loops are never split). Every region is a separate function; the contract function is
+/// then a trampoline calling the region which continues the execution.
+std::string compile_cxx(evmc_revision rev, bytes_view code, const CompileOptions& options = {});
+
+/// Wraps compile_cxx() into a self-contained translation unit.
+/// It must be compiled with options.definitions(): it does not build otherwise.
+///
+/// The generated function gets internal linkage and is exported as
+///
+///     extern "C" evmc_result <entry_name>(ExecutionState& state)
+///
+/// so that the same contract can be linked more than once (e.g. for different revisions).
+std::string compile_translation_unit(evmc_revision rev, bytes_view code,
+    std::string_view entry_name, const CompileOptions& options = {});
+}  // namespace evmone
@@ -0,0 +1,197 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "compile_service.hpp"
+
+namespace evmone
+{
+namespace
+{
+CompileService::Result ready(CompileStatus status)
+{
+    std::promise<CompileResult> promise;
+    promise.set_value({status});
+    return promise.get_future().share();
+}
+}  // namespace
+
+CompileService::CompileService(CodeCache& cache, CompileOptions options, unsigned num_workers,
+    size_t max_pending, Callback on_compiled)
+  : m_cache{cache},
+    m_options{options},
+    m_max_pending{max_pending},
+    m_on_compiled{std::move(on_compiled)}
+{
+    m_workers.reserve(num_workers);
+    for (unsigned i = 0; i < num_workers; ++i)
+        m_workers.emplace_back(&CompileService::work, this);
+}
+
+CompileService::~CompileService() noexcept
+{
+    {
+        std::lock_guard lock{m_mutex};
+        m_stop = true;
+        while (!m_queue.empty())
+            drop(m_jobs.find(m_queue.begin()->second), CompileStatus::dropped);
+    }
+    m_cv.notify_all();
+    for (auto& worker : m_workers)
+        worker.join();
+}
+
+CompileService::Result CompileService::submit(
+    const ContractKey& key, bytes_view code, uint64_t priority)
+{
+    std::unique_lock lock{m_mutex};
+    if (const auto it = m_jobs.find(key); it != m_jobs.end())
+    {
+        auto& job = it->second;
+        job.cancelled = false;  // Resubmitted while running: keep the result after all.
+        raise_priority(job, key, priority);
+        return job.result;
+    }
+
+    if (m_failed.contains(key))
+        return ready(CompileStatus::failed);
+    if (m_stop)
+        return ready(CompileStatus::dropped);
+
+    if (m_queue.size() >= m_max_pending)
+    {
+        if (m_queue.empty() || std::prev(m_queue.end())->first >= priority)
+            return ready(CompileStatus::dropped);
+        drop(m_jobs.find(std::prev(m_queue.end())->second), CompileStatus::dropped);
+    }
+
+    auto& job = m_jobs[key];
+    job.code = bytes{code};
+    job.result = job.promise.get_future().share();
+    job.position = m_queue.emplace(priority, key);
+    auto result = job.result;
+    lock.unlock();
+    m_cv.notify_one();
+    return result;
+}
+
+bool CompileService::raise_priority(const ContractKey& key, uint64_t priority) noexcept
+{
+    std::lock_guard lock{m_mutex};
+    const auto it = m_jobs.find(key);
+    if (it == m_jobs.end())
+        return false;
+    raise_priority(it->second, key, priority);
+    return true;
+}
+
+bool CompileService::failed(const ContractKey& key) const noexcept
+{
+    std::lock_guard lock{m_mutex};
+    return m_failed.contains(key);
+}
+
+void CompileService::raise_priority(Job& job, const ContractKey& key, uint64_t priority) noexcept
+{
+    if (!job.running && priority > job.position->first)
+    {
+        m_queue.erase(job.position);
+        job.position = m_queue.emplace(priority, key);
+    }
+}
+
+bool CompileService::cancel(const ContractKey& key) noexcept
+{
+    std::lock_guard lock{m_mutex};
+    const auto it = m_jobs.find(key);
+    if (it == m_jobs.end())
+        return false;
+    if (it->second.running)
+        it->second.cancelled = true;  // The external compiler process cannot be interrupted.
+    else
+        drop(it, CompileStatus::cancelled);
+    return true;
+}
+
+size_t CompileService::num_pending() const noexcept
+{
+    std::lock_guard lock{m_mutex};
+    return m_queue.size();
+}
+
+size_t CompileService::num_running() const noexcept
+{
+    std::lock_guard lock{m_mutex};
+    return m_num_running;
+}
+
+void CompileService::drop(Jobs::iterator it, CompileStatus status) noexcept
+{
+    m_queue.erase(it->second.position);
+    it->second.promise.set_value({status});
+    m_jobs.erase(it);
+}
+
+void CompileService::work() noexcept
+{
+    std::unique_lock lock{m_mutex};
+    while (true)
+    {
+        m_cv.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+        if (m_stop)
+            return;
+
+        const auto key = m_queue.begin()->second;
+        m_queue.erase(m_queue.begin());
+        auto& job = m_jobs.at(key);  // References to map elements survive rehashing.
+        job.running = true;
+        ++m_num_running;
+        lock.unlock();
+
+        CompileResult result{CompileStatus::failed};
+        try
+        {
+            if (m_cache.build(key.rev, job.code, m_options))
+                result.fn = m_cache.find({key.code_hash, key.rev, m_options});
+        }
+        catch (...)
+        {
+            // E.g. out of memory or a file system error: the compilation has failed.
+        }
+        if (result.fn != nullptr)
+            result.status = CompileStatus::compiled;
+
+        lock.lock();
+        --m_num_running;
+        if (result.status == CompileStatus::failed)
+        {
+            try
+            {
+                m_failed.insert(key);
+            }
+            catch (...)
+            {
+                // Out of memory: the contract may be queued again.
+            }
+        }
+        else if (job.cancelled)
+            result = {CompileStatus::cancelled};
+        if (result.fn != nullptr && m_on_compiled)
+        {
+            // Make the native code available before the waiters are woken up.
+            lock.unlock();
+            try
+            {
+                m_on_compiled(key, result.fn);
+            }
+            catch (...)
+            {
+                // The native code is still returned to the waiters.
+            }
+            lock.lock();
+        }
+        job.promise.set_value(result);
+        m_jobs.erase(key);
+    }
+}
+}  // namespace evmone
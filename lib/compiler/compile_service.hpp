@@ -0,0 +1,118 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "cache.hpp"
+#include "registry.hpp"
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <map>
+#include <thread>
+#include <unordered_set>
+
+namespace evmone
+{
+/// The outcome of a compilation of CompileService.
+enum class CompileStatus : uint8_t
+{
+    compiled,   ///< The native code is available.
+    failed,     ///< The build has failed. The contract is not compiled again.
+    dropped,    ///< Dropped by a full queue or by the destructor before being compiled.
+    cancelled,  ///< Cancelled by CompileService::cancel().
+};
+
+struct CompileResult
+{
+    CompileStatus status;
+    native_contract fn = nullptr;  ///< The entry point of the compiled contract.
+};
+
+/// Asynchronous compilation of contracts into a CodeCache by a pool of worker threads.
+///
+/// The pending compilations are ordered by priority (e.g. the gas used by the interpreted
+/// contract), the highest first. A contract submitted again while pending is not queued twice:
+/// the submission raises its priority and shares its future. When the queue is full the pending
+/// compilation of the lowest priority is dropped, or the new one if it has the lowest priority.
+///
+/// The result of a compilation is the entry point of the contract or the reason why there is
+/// none. The contracts whose build has failed are remembered: they are not queued again.
+class CompileService
+{
+public:
+    using Result = std::shared_future<CompileResult>;
+
+    /// Called by a worker thread with every successfully compiled contract before
+    /// the result is made available. Exceptions thrown by the callback are ignored.
+    using Callback = std::function<void(const ContractKey& key, native_contract fn)>;
+
+    /// Starts the workers compiling contracts into the cache with the given options.
+    CompileService(CodeCache& cache, CompileOptions options, unsigned num_workers,
+        size_t max_pending, Callback on_compiled = {});
+
+    /// Cancels the pending compilations and waits for the running ones.
+    ~CompileService() noexcept;
+
+    CompileService(const CompileService&) = delete;
+    CompileService& operator=(const CompileService&) = delete;
+
+    /// Queues the compilation of the contract or raises the priority of the pending one.
+    /// The contracts which have failed are not queued: their result is ready at once.
+    Result submit(const ContractKey& key, bytes_view code, uint64_t priority);
+
+    /// Raises the priority of the pending compilation of the contract, if any.
+    /// Returns false if the contract is neither pending nor being compiled, e.g. because
+    /// its compilation has failed or been dropped.
+    bool raise_priority(const ContractKey& key, uint64_t priority) noexcept;
+
+    /// Returns true if the build of the contract has failed.
+    [[nodiscard]] bool failed(const ContractKey& key) const noexcept;
+
+    /// Cancels the compilation of the contract. A running compilation finishes but its
+    /// result is discarded. Returns false if there is no such compilation.
+    bool cancel(const ContractKey& key) noexcept;
+
+    /// Returns the number of queued (not yet running) compilations.
+    [[nodiscard]] size_t num_pending() const noexcept;
+
+    /// Returns the number of compilations being run by the workers.
+    [[nodiscard]] size_t num_running() const noexcept;
+
+private:
+    using Queue = std::multimap<uint64_t, ContractKey, std::greater<>>;
+
+    struct Job
+    {
+        bytes code;
+        std::promise<CompileResult> promise;
+        Result result;
+        Queue::iterator position;  ///< The position in the queue, if pending.
+        bool running = false;
+        bool cancelled = false;
+    };
+    using Jobs = std::unordered_map<ContractKey, Job, ContractKeyHash>;
+
+    CodeCache& m_cache;
+    const CompileOptions m_options;
+    const size_t m_max_pending;
+    const Callback m_on_compiled;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cv;
+    Jobs m_jobs;    ///< Pending and running.
+    Queue m_queue;  ///< Pending by priority.
+    std::unordered_set<ContractKey, ContractKeyHash> m_failed;
+    size_t m_num_running = 0;
+    bool m_stop = false;
+    std::vector<std::thread> m_workers;
+
+    void work() noexcept;
+
+    /// Moves the pending job up in the queue. Requires the lock.
+    void raise_priority(Job& job, const ContractKey& key, uint64_t priority) noexcept;
+
+    /// Completes and removes the pending job with the status. Requires the lock.
+    void drop(Jobs::iterator it, CompileStatus status) noexcept;
+};
+}  // namespace evmone
@@ -0,0 +1,181 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "jit.hpp"
+#include <clang/Basic/Diagnostic.h>
+#include <clang/Basic/DiagnosticOptions.h>
+#include <clang/CodeGen/CodeGenAction.h>
+#include <clang/Frontend/CompilerInstance.h>
+#include <clang/Frontend/CompilerInvocation.h>
+#include <clang/Frontend/TextDiagnosticBuffer.h>
+#include <clang/Frontend/Utils.h>
+#include <ethash/keccak.h>
+#include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/TargetSelect.h>
+#include <atomic>
+#include <mutex>
+
+namespace evmone
+{
+namespace
+{
+/// The virtual file name of the translation unit handed to clang.
+constexpr auto source_name = "contract.cpp";
+
+/// Include directories of compiler-rt and its dependencies separated by '|'.
+constexpr std::string_view include_dirs = EVMONE_JIT_INCLUDE_DIRS;
+
+void set_error(std::string* error, std::string message)
+{
+    if (error != nullptr)
+        *error = std::move(message);
+}
+
+/// Builds the clang driver command line for compiling the generated code.
+std::vector<std::string> driver_args(const CompileOptions& options)
+{
+    std::vector<std::string> args{EVMONE_JIT_CLANG, "-c", "-x", "c++", "-std=c++23",
+        "-O" + std::to_string(options.opt_level), "-march=native", "-fno-exceptions", "-w"};
+    for (size_t pos = 0; pos < include_dirs.size();)
+    {
+        const auto end = std::min(include_dirs.find('|', pos), include_dirs.size());
+        if (end != pos)
+            args.emplace_back("-I" + std::string{include_dirs.substr(pos, end - pos)});
+        pos = end + 1;
+    }
+    for (auto& def : options.definitions())
+        args.emplace_back(std::move(def));
+    args.emplace_back(source_name);
+    return args;
+}
+}  // namespace
+
+struct Jit::Impl
+{
+    CompileOptions options;
+    std::vector<std::string> args;
+    std::unique_ptr<llvm::orc::LLJIT> lljit;
+
+    /// Counter for unique entry point names: the same contract may be compiled more than once
+    /// (e.g. for different revisions).
+    std::atomic<uint64_t> num_compiled = 0;
+};
+
+Jit::Jit(std::unique_ptr<Impl> impl) noexcept : m_impl{std::move(impl)} {}
+
+Jit::~Jit() noexcept = default;
+
+const CompileOptions& Jit::options() const noexcept
+{
+    return m_impl->options;
+}
+
+std::unique_ptr<Jit> Jit::create(CompileOptions options, std::string* error)
+{
+    static std::once_flag target_initialized;
+    std::call_once(target_initialized, [] {
+        llvm::InitializeNativeTarget();
+        llvm::InitializeNativeTargetAsmPrinter();
+    });
+
+    auto lljit = llvm::orc::LLJITBuilder().create();
+    if (!lljit)
+    {
+        set_error(error, llvm::toString(lljit.takeError()));
+        return nullptr;
+    }
+
+    // Resolve the compiler-rt opcode handlers from the running process.
+    auto& main_jd = (*lljit)->getMainJITDylib();
+    auto process_symbols = llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(
+        (*lljit)->getDataLayout().getGlobalPrefix());
+    if (!process_symbols)
+    {
+        set_error(error, llvm::toString(process_symbols.takeError()));
+        return nullptr;
+    }
+    main_jd.addGenerator(std::move(*process_symbols));
+
+    // ethash is linked statically so its symbols may be missing in the dynamic symbol table.
+    llvm::orc::MangleAndInterner mangle{(*lljit)->getExecutionSession(), (*lljit)->getDataLayout()};
+    llvm::orc::SymbolMap ethash_symbols;
+    ethash_symbols[mangle("ethash_keccak256")] = {
+        llvm::orc::ExecutorAddr::fromPtr(&ethash_keccak256), llvm::JITSymbolFlags::Exported};
+    if (auto err = main_jd.define(llvm::orc::absoluteSymbols(std::move(ethash_symbols))))
+    {
+        set_error(error, llvm::toString(std::move(err)));
+        return nullptr;
+    }
+
+    auto impl = std::make_unique<Impl>();
+    impl->options = options;
+    impl->args = driver_args(options);
+    impl->lljit = std::move(*lljit);
+    return std::unique_ptr<Jit>{new Jit{std::move(impl)}};
+}
+
+native_contract Jit::compile(evmc_revision rev, bytes_view code, std::string* error)
+{
+    const auto entry_name = "evmone_jit_entry_" + std::to_string(m_impl->num_compiled++);
+    const auto source = compile_translation_unit(rev, code, entry_name, m_impl->options);
+
+    // Run the clang frontend and the optimizer on the in-memory source.
+    std::vector<const char*> argv;
+    argv.reserve(m_impl->args.size());
+    for (const auto& arg : m_impl->args)
+        argv.push_back(arg.c_str());
+
+    auto diag_opts = llvm::makeIntrusiveRefCnt<clang::DiagnosticOptions>();
+    auto* diag_buffer = new clang::TextDiagnosticBuffer;
+    auto diags = clang::CompilerInstance::createDiagnostics(diag_opts.get(), diag_buffer);
+
+    clang::CreateInvocationOptions invocation_opts;
+    invocation_opts.Diags = diags;
+    std::shared_ptr<clang::CompilerInvocation> invocation =
+        clang::createInvocation(argv, std::move(invocation_opts));
+    if (!invocation)
+    {
+        set_error(error, "invalid clang invocation");
+        return nullptr;
+    }
+    invocation->getPreprocessorOpts().addRemappedFile(
+        source_name, llvm::MemoryBuffer::getMemBufferCopy(source).release());
+
+    clang::CompilerInstance compiler;
+    compiler.setInvocation(std::move(invocation));
+    compiler.setDiagnostics(diags.get());
+
+    auto context = std::make_unique<llvm::LLVMContext>();
+    clang::EmitLLVMOnlyAction action{context.get()};
+    if (!compiler.ExecuteAction(action))
+    {
+        std::string message;
+        for (auto it = diag_buffer->err_begin(); it != diag_buffer->err_end(); ++it)
+            message += it->second + '\n';
+        set_error(error, std::move(message));
+        return nullptr;
+    }
+
+    // Link the module into the JIT and resolve the entry point.
+    auto& lljit = *m_impl->lljit;
+    if (auto err = lljit.addIRModule(
+            llvm::orc::ThreadSafeModule{action.takeModule(), std::move(context)}))
+    {
+        set_error(error, llvm::toString(std::move(err)));
+        return nullptr;
+    }
+
+    auto entry = lljit.lookup(entry_name);
+    if (!entry)
+    {
+        set_error(error, llvm::toString(entry.takeError()));
+        return nullptr;
+    }
+    return entry->toPtr<native_contract>();
+}
+}  // namespace evmone
@@ -0,0 +1,41 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "codegen.hpp"
+#include <memory>
+
+namespace evmone
+{
+/// The in-process backend of the compiler.
+///
+/// The C++ function generated by compile_cxx() is compiled by the embedded clang frontend
+/// and linked by the LLVM ORC JIT against the compiler-rt opcode handlers of the running
+/// process (so compiler-rt must be loaded as a shared library or with exported symbols).
+/// The native code stays alive as long as the Jit object.
+class Jit
+{
+    struct Impl;
+    std::unique_ptr<Impl> m_impl;
+
+    explicit Jit(std::unique_ptr<Impl> impl) noexcept;
+
+public:
+    /// Creates the JIT for the host CPU. Returns nullptr on failure and sets the error message.
+    static std::unique_ptr<Jit> create(CompileOptions options = {}, std::string* error = nullptr);
+
+    ~Jit() noexcept;
+
+    Jit(const Jit&) = delete;
+    Jit& operator=(const Jit&) = delete;
+
+    /// Compiles the contract code and returns its native entry point.
+    /// Returns nullptr on failure and sets the error message (e.g. the clang diagnostics).
+    ///
+    /// Can be called concurrently from multiple threads.
+    native_contract compile(evmc_revision rev, bytes_view code, std::string* error = nullptr);
+
+    [[nodiscard]] const CompileOptions& options() const noexcept;
+};
+}  // namespace evmone
@@ -0,0 +1,94 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "profiler.hpp"
+#include <mutex>
+
+namespace evmone
+{
+std::shared_ptr<HotnessCounters> HotnessProfiler::record(
+    const evmc::bytes32& code_hash, evmc_revision rev, uint64_t gas_used)
+{
+    std::shared_ptr<HotnessCounters> counters;
+    {
+        std::shared_lock lock{m_mutex};
+        if (const auto it = m_counters.find({code_hash, rev}); it != m_counters.end())
+            counters = it->second;
+    }
+    if (counters == nullptr)
+    {
+        std::unique_lock lock{m_mutex};
+        if (m_counters.size() >= max_contracts && !m_counters.contains({code_hash, rev}))
+            decay();
+        auto& c = m_counters[{code_hash, rev}];
+        if (c == nullptr)
+            c = std::make_shared<HotnessCounters>();
+        counters = c;
+    }
+
+    // Relaxed ordering is enough: the counters are statistics.
+    counters->num_calls.fetch_add(1, std::memory_order_relaxed);
+    counters->gas_used.fetch_add(gas_used, std::memory_order_relaxed);
+    return counters;
+}
+
+bool HotnessProfiler::promote(HotnessCounters& counters) const noexcept
+{
+    if (counters.hot.load(std::memory_order_relaxed))
+        return false;
+
+    const auto num_calls = counters.num_calls.load(std::memory_order_relaxed);
+    const auto gas_used = counters.gas_used.load(std::memory_order_relaxed);
+    const bool hot = (thresholds.num_calls != 0 && num_calls >= thresholds.num_calls) ||
+                     (thresholds.gas_used != 0 && gas_used >= thresholds.gas_used);
+
+    // Exactly one thread wins the exchange of the hot flag.
+    return hot && !counters.hot.exchange(true, std::memory_order_relaxed);
+}
+
+void HotnessProfiler::demote(HotnessCounters& counters) noexcept
+{
+    counters.num_calls.store(0, std::memory_order_relaxed);
+    counters.gas_used.store(0, std::memory_order_relaxed);
+    counters.hot.store(false, std::memory_order_relaxed);
+}
+
+void HotnessProfiler::decay() noexcept
+{
+    // Halve until there is room: each pass removes at least the contracts executed once,
+    // and after 64 passes only the hot contracts are left.
+    for (int pass = 0; pass < 64 && m_counters.size() >= max_contracts; ++pass)
+    {
+        std::erase_if(m_counters, [](const auto& entry) {
+            auto& c = *entry.second;
+            const auto num_calls = c.num_calls.load(std::memory_order_relaxed) / 2;
+            c.num_calls.store(num_calls, std::memory_order_relaxed);
+            c.gas_used.store(c.gas_used.load(std::memory_order_relaxed) / 2,
+                std::memory_order_relaxed);
+            // The hot contracts are being compiled: they are removed once built.
+            return num_calls == 0 && !c.hot.load(std::memory_order_relaxed);
+        });
+    }
+}
+
+void HotnessProfiler::remove(const evmc::bytes32& code_hash, evmc_revision rev)
+{
+    std::unique_lock lock{m_mutex};
+    m_counters.erase({code_hash, rev});
+}
+
+std::shared_ptr<const HotnessCounters> HotnessProfiler::find(
+    const evmc::bytes32& code_hash, evmc_revision rev) const
+{
+    std::shared_lock lock{m_mutex};
+    const auto it = m_counters.find({code_hash, rev});
+    return it != m_counters.end() ? it->second : nullptr;
+}
+
+size_t HotnessProfiler::size() const
+{
+    std::shared_lock lock{m_mutex};
+    return m_counters.size();
+}
+}  // namespace evmone
@@ -0,0 +1,74 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "registry.hpp"
+#include <atomic>
+#include <memory>
+
+namespace evmone
+{
+/// Thresholds making a contract hot. Zero disables the given threshold.
+struct HotnessThresholds
+{
+    uint64_t num_calls = 0;  ///< The number of executions.
+    uint64_t gas_used = 0;   ///< The cumulative gas used by the executions.
+
+    [[nodiscard]] bool enabled() const noexcept { return num_calls != 0 || gas_used != 0; }
+};
+
+/// The execution counters of a contract.
+struct HotnessCounters
+{
+    std::atomic<uint64_t> num_calls = 0;
+    std::atomic<uint64_t> gas_used = 0;
+
+    /// Set once the contract has crossed a threshold, until demoted.
+    std::atomic<bool> hot = false;
+};
+
+/// Thread-safe per (code hash, revision) execution counters of the interpreted contracts.
+///
+/// The counters are created on the first execution of a contract and removed once it has been
+/// compiled. The number of the profiled contracts is bounded: when it reaches max_contracts,
+/// the counters of all contracts are halved and the ones of the contracts left without
+/// executions are removed, so the contracts executed only long ago make room for the new ones.
+/// The counters are shared with the callers, so they stay valid after removal.
+class HotnessProfiler
+{
+    mutable std::shared_mutex m_mutex;
+    std::unordered_map<ContractKey, std::shared_ptr<HotnessCounters>, ContractKeyHash> m_counters;
+
+    /// Halves the counters and removes the contracts without executions (with the lock held).
+    void decay() noexcept;
+
+public:
+    HotnessThresholds thresholds;
+
+    /// The maximum number of the profiled contracts.
+    size_t max_contracts = size_t{1} << 16;
+
+    /// Records an execution of the contract and returns its counters.
+    std::shared_ptr<HotnessCounters> record(
+        const evmc::bytes32& code_hash, evmc_revision rev, uint64_t gas_used);
+
+    /// Marks the contract hot if it has crossed a threshold.
+    /// Returns true exactly once: for the first call after the contract has become hot.
+    bool promote(HotnessCounters& counters) const noexcept;
+
+    /// Resets the counters of a hot contract which is still interpreted (its compilation
+    /// has failed or been dropped) so that it is promoted again once it crosses a threshold.
+    static void demote(HotnessCounters& counters) noexcept;
+
+    /// Stops profiling the contract, e.g. once it has been compiled.
+    void remove(const evmc::bytes32& code_hash, evmc_revision rev);
+
+    /// Returns the counters of the contract or nullptr if not profiled.
+    [[nodiscard]] std::shared_ptr<const HotnessCounters> find(
+        const evmc::bytes32& code_hash, evmc_revision rev) const;
+
+    /// Returns the number of the profiled contracts.
+    [[nodiscard]] size_t size() const;
+};
+}  // namespace evmone
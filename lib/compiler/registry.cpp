@@ -0,0 +1,92 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "registry.hpp"
+#include <dlfcn.h>
+#include <cstring>
+#include <mutex>
+
+namespace evmone
+{
+ContractRegistry::~ContractRegistry() noexcept
+{
+    for (auto* library : m_libraries)
+        ::dlclose(library);
+}
+
+void ContractRegistry::add(const evmc::bytes32& code_hash, evmc_revision rev, native_contract fn)
+{
+    std::unique_lock lock{m_mutex};
+    m_contracts[{code_hash, rev}] = fn;
+}
+
+native_contract ContractRegistry::find(
+    const evmc::bytes32& code_hash, evmc_revision rev) const noexcept
+{
+    std::shared_lock lock{m_mutex};
+    const auto it = m_contracts.find({code_hash, rev});
+    return it != m_contracts.end() ? it->second : nullptr;
+}
+
+bool ContractRegistry::missing(
+    const evmc::bytes32& code_hash, evmc_revision rev, uint64_t generation) const noexcept
+{
+    std::shared_lock lock{m_mutex};
+    return generation == m_missing_generation && m_missing.contains({code_hash, rev});
+}
+
+void ContractRegistry::add_missing(
+    const evmc::bytes32& code_hash, evmc_revision rev, uint64_t generation)
+{
+    std::unique_lock lock{m_mutex};
+    if (generation < m_missing_generation)
+        return;  // Already outdated.
+    if (generation != m_missing_generation || m_missing.size() >= max_missing)
+    {
+        m_missing.clear();
+        m_missing_generation = generation;
+    }
+    m_missing.insert({code_hash, rev});
+}
+
+bool ContractRegistry::load(const std::filesystem::path& library, std::string* error)
+{
+    auto* const handle = ::dlopen(library.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (handle == nullptr)
+    {
+        if (error != nullptr)
+            *error = ::dlerror();
+        return false;
+    }
+
+    const auto* const contracts =
+        static_cast<const CompiledContract*>(::dlsym(handle, "evmone_aot_contracts"));
+    const auto* const num_contracts =
+        static_cast<const size_t*>(::dlsym(handle, "evmone_aot_num_contracts"));
+    if (contracts == nullptr || num_contracts == nullptr)
+    {
+        if (error != nullptr)
+            *error = library.string() + ": no table of compiled contracts";
+        ::dlclose(handle);
+        return false;
+    }
+
+    std::unique_lock lock{m_mutex};
+    m_libraries.push_back(handle);
+    for (size_t i = 0; i < *num_contracts; ++i)
+    {
+        const auto& c = contracts[i];
+        ContractKey key{{}, c.rev};
+        std::memcpy(key.code_hash.bytes, c.code_hash, sizeof(c.code_hash));
+        m_contracts[key] = c.fn;
+    }
+    return true;
+}
+
+size_t ContractRegistry::size() const noexcept
+{
+    std::shared_lock lock{m_mutex};
+    return m_contracts.size();
+}
+}  // namespace evmone
@@ -0,0 +1,86 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "aot_execution_state.hpp"
+#include <filesystem>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace evmone
+{
+/// An entry of the table of compiled contracts exported by a shared library as
+///
+///     extern "C" const CompiledContract evmone_aot_contracts[];
+///     extern "C" const size_t evmone_aot_num_contracts;
+struct CompiledContract
+{
+    uint8_t code_hash[32];
+    evmc_revision rev;
+    native_contract fn;
+};
+
+/// Identifies the native code of a contract at run time.
+struct ContractKey
+{
+    evmc::bytes32 code_hash;
+    evmc_revision rev;
+
+    friend bool operator==(const ContractKey&, const ContractKey&) noexcept = default;
+};
+
+struct ContractKeyHash
+{
+    size_t operator()(const ContractKey& key) const noexcept
+    {
+        return std::hash<evmc::bytes32>{}(key.code_hash) ^ size_t(key.rev);
+    }
+};
+
+/// Thread-safe map from (code hash, revision) to the native code of compiled contracts.
+class ContractRegistry
+{
+    mutable std::shared_mutex m_mutex;
+    std::unordered_map<ContractKey, native_contract, ContractKeyHash> m_contracts;
+    std::vector<void*> m_libraries;
+
+    /// The contracts missing from the CodeCache of the generation m_missing_generation.
+    std::unordered_set<ContractKey, ContractKeyHash> m_missing;
+    uint64_t m_missing_generation = 0;
+
+public:
+    /// The maximum number of the recorded missing contracts: the set is cleared when full.
+    static constexpr size_t max_missing = 65536;
+
+    ContractRegistry() = default;
+    ~ContractRegistry() noexcept;
+
+    ContractRegistry(const ContractRegistry&) = delete;
+    ContractRegistry& operator=(const ContractRegistry&) = delete;
+
+    /// Registers (or replaces) the native code of the contract.
+    void add(const evmc::bytes32& code_hash, evmc_revision rev, native_contract fn);
+
+    /// Returns the native code of the contract or nullptr if not registered.
+    [[nodiscard]] native_contract find(
+        const evmc::bytes32& code_hash, evmc_revision rev) const noexcept;
+
+    /// Returns true if the contract has been recorded missing from the CodeCache of the given
+    /// generation (see CodeCache::generation()).
+    [[nodiscard]] bool missing(
+        const evmc::bytes32& code_hash, evmc_revision rev, uint64_t generation) const noexcept;
+
+    /// Records the contract missing from the CodeCache of the given generation.
+    /// The contracts recorded for older generations are forgotten.
+    void add_missing(const evmc::bytes32& code_hash, evmc_revision rev, uint64_t generation);
+
+    /// Loads the shared library and registers its table of compiled contracts.
+    /// Returns false on failure and sets the error message.
+    bool load(const std::filesystem::path& library, std::string* error = nullptr);
+
+    /// Returns the number of registered contracts.
+    [[nodiscard]] size_t size() const noexcept;
+};
+}  // namespace evmone
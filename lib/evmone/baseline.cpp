@@ -6,6 +6,7 @@
 #include "baseline_instruction_table.hpp"
 #include "eof.hpp"
 #include "execution_state.hpp"
+#include "execution_state_pool.hpp"
 #include "instructions.hpp"
 #include "vm.hpp"
 #include <memory>
@@ -366,9 +367,13 @@ evmc_result execute(evmc_vm* c_vm, const evmc_host_interface* host, evmc_host_co
 {
     auto vm = static_cast<VM*>(c_vm);
     const bytes_view container{code, code_size};
-    const auto code_analysis = analyze(rev, container);
-    const auto data = code_analysis.eof_header.get_data(container);
-    auto state = std::make_unique<ExecutionState>(*msg, rev, *host, ctx, container, data);
-    return execute(*vm, msg->gas, *state, code_analysis);
+    // The initcode is executed once: its analysis would only evict the cached ones.
+    const auto code_analysis = (msg->kind == EVMC_CREATE || msg->kind == EVMC_CREATE2) ?
+                                   std::make_shared<const CodeAnalysis>(analyze(rev, container)) :
+                                   vm->analysis_cache.get(rev, container);
+    const auto data = code_analysis->eof_header.get_data(container);
+    const auto state =
+        ExecutionStatePool::local().acquire(*msg, rev, *host, ctx, container, data);
+    return execute(*vm, msg->gas, *state, *code_analysis);
 }
 }  // namespace evmone::baseline
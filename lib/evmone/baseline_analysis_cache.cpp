@@ -0,0 +1,86 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2023 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "baseline_analysis_cache.hpp"
+#include <cstring>
+#include <mutex>
+
+namespace evmone::baseline
+{
+std::shared_ptr<const CodeAnalysis> CodeAnalysisCache::get(evmc_revision rev, bytes_view code)
+{
+    // The legacy analysis does not depend on the revision, only the choice of the EOF one does.
+    const bool cacheable = rev < EVMC_PRAGUE || !is_eof_container(code);
+    const Key key{code.data(), code.size()};
+
+    if (cacheable)
+    {
+        std::shared_lock lock{m_mutex};
+        if (const auto it = m_entries.find(key); it != m_entries.end())
+        {
+            auto& entry = it->second;
+            // The padded copy of the code starts with the code itself.
+            if (std::memcmp(entry.analysis->executable_code.data(), code.data(), code.size()) == 0)
+            {
+                entry.last_use.store(++m_tick, std::memory_order_relaxed);
+                m_num_hits.fetch_add(1, std::memory_order_relaxed);
+                return entry.analysis;
+            }
+        }
+    }
+
+    m_num_misses.fetch_add(1, std::memory_order_relaxed);
+    auto analysis = std::make_shared<const CodeAnalysis>(analyze(rev, code));
+    if (!cacheable)
+        return analysis;
+
+    std::unique_lock lock{m_mutex};
+    if (m_capacity == 0)
+        return analysis;
+    if (!m_entries.contains(key))
+        evict(m_capacity - 1);
+    const auto [it, inserted] = m_entries.try_emplace(key);
+    auto& entry = it->second;  // Replaces the stale entry of other code at the same address.
+    if (inserted)
+        entry.lru_pos = m_lru.insert(m_lru.begin(), key);
+    else
+        m_lru.splice(m_lru.begin(), m_lru, entry.lru_pos);
+    entry.analysis = analysis;
+    entry.placed = ++m_tick;
+    entry.last_use.store(entry.placed, std::memory_order_relaxed);
+    return analysis;
+}
+
+void CodeAnalysisCache::set_capacity(size_t capacity) noexcept
+{
+    std::unique_lock lock{m_mutex};
+    m_capacity = capacity;
+    evict(capacity);
+}
+
+size_t CodeAnalysisCache::size() const noexcept
+{
+    std::shared_lock lock{m_mutex};
+    return m_entries.size();
+}
+
+void CodeAnalysisCache::evict(size_t max_size) noexcept
+{
+    while (m_entries.size() > max_size)
+    {
+        const auto it = m_entries.find(m_lru.back());
+        auto& entry = it->second;
+        const auto last_use = entry.last_use.load(std::memory_order_relaxed);
+        if (last_use != entry.placed)
+        {
+            // Used since placed: move it to the front, at most once per lookup.
+            entry.placed = last_use;
+            m_lru.splice(m_lru.begin(), m_lru, entry.lru_pos);
+            continue;
+        }
+        m_lru.pop_back();
+        m_entries.erase(it);
+    }
+}
+}  // namespace evmone::baseline
@@ -0,0 +1,104 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2023 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "baseline.hpp"
+#include <atomic>
+#include <list>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace evmone::baseline
+{
+/// Thread-safe bounded cache of the code analyses of the legacy code.
+///
+/// The analyses are looked up by the address and the size of the code, as passed to
+/// the execute() of EVMC, and validated by comparing the code: hosts keep the code of an
+/// account in place, so repeated calls of a contract find its analysis without hashing the code.
+/// The analyses are shared: an entry evicted (or replaced) while executing stays alive until
+/// the execution ends. The EOF analyses refer to the code itself and are not cached.
+///
+/// The lookups only take the shared lock and mark the entry used. The entries are kept in
+/// the order of their insertion and the eviction gives the ones used since then another
+/// round at the front, so the least recently used entries go first without scanning them all.
+class CodeAnalysisCache
+{
+public:
+    /// The default maximum number of entries.
+    static constexpr size_t default_capacity = 1024;
+
+    explicit CodeAnalysisCache(size_t capacity = default_capacity) noexcept
+      : m_capacity{capacity}
+    {}
+
+    /// Returns the analysis of the code, cached if it is legacy code.
+    [[nodiscard]] std::shared_ptr<const CodeAnalysis> get(evmc_revision rev, bytes_view code);
+
+    /// Sets the maximum number of entries (0 disables the cache) and evicts the excess ones.
+    void set_capacity(size_t capacity) noexcept;
+
+    /// Returns the number of entries.
+    [[nodiscard]] size_t size() const noexcept;
+
+    /// Returns the number of lookups which have found the analysis.
+    [[nodiscard]] uint64_t num_hits() const noexcept
+    {
+        return m_num_hits.load(std::memory_order_relaxed);
+    }
+
+    /// Returns the number of lookups which have analyzed the code.
+    [[nodiscard]] uint64_t num_misses() const noexcept
+    {
+        return m_num_misses.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Key
+    {
+        const uint8_t* code;
+        size_t code_size;
+
+        friend bool operator==(const Key&, const Key&) noexcept = default;
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const noexcept
+        {
+            return std::hash<const uint8_t*>{}(key.code) ^ key.code_size;
+        }
+    };
+
+    struct Entry
+    {
+        std::shared_ptr<const CodeAnalysis> analysis;
+
+        /// The tick of the last lookup, for the eviction of the least recently used entry.
+        std::atomic<uint64_t> last_use = 0;
+
+        /// The tick of the last lookup when the entry was put at the front of the LRU list.
+        /// Requires the exclusive lock.
+        uint64_t placed = 0;
+
+        /// The position in the LRU list. Requires the exclusive lock.
+        std::list<Key>::iterator lru_pos;
+    };
+
+    mutable std::shared_mutex m_mutex;
+    std::unordered_map<Key, Entry, KeyHash> m_entries;
+
+    /// The keys of the entries, the most recently placed first.
+    std::list<Key> m_lru;
+
+    size_t m_capacity;
+    std::atomic<uint64_t> m_tick = 0;
+    std::atomic<uint64_t> m_num_hits = 0;
+    std::atomic<uint64_t> m_num_misses = 0;
+
+    /// Evicts the least recently used entries until there are at most max_size.
+    /// Requires the exclusive lock.
+    void evict(size_t max_size) noexcept;
+};
+}  // namespace evmone::baseline
@@ -85,6 +85,7 @@ public:
 
     [[nodiscard]] const uint8_t* data() const noexcept { return m_data; }
     [[nodiscard]] size_t size() const noexcept { return m_size; }
+    [[nodiscard]] size_t capacity() const noexcept { return m_capacity; }
 
     /// Grows the memory to the given size. The extend is filled with zeros.
     ///
@@ -190,6 +191,8 @@ public:
         output_offset = 0;
         output_size = 0;
         m_tx = {};
+        analysis.baseline = nullptr;
+        call_stack.clear();
     }
 
     [[nodiscard]] bool in_static_mode() const { return (msg->flags & EVMC_STATIC) != 0; }
@@ -0,0 +1,10 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2023 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "execution_state_pool.hpp"
+
+namespace evmone
+{
+template class StatePool<ExecutionState>;
+}  // namespace evmone
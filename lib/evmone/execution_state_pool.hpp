@@ -0,0 +1,15 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2023 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "execution_state.hpp"
+#include "state_pool.hpp"
+
+namespace evmone
+{
+/// The per-thread pool of the execution states of the interpreter.
+using ExecutionStatePool = StatePool<ExecutionState>;
+
+extern template class StatePool<ExecutionState>;
+}  // namespace evmone
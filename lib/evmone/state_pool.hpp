@@ -0,0 +1,144 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2023 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <evmc/evmc.h>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace evmone
+{
+/// The per-thread pool of the execution states, indexed by the call depth.
+///
+/// A call chain uses at most one state per depth, so after the first execution at a given depth
+/// the states are only reset: a deep call chain or a hot CALL loop does no allocations, and the
+/// memory buffers keep their grown capacity (up to max_retained_memory) across the calls.
+/// A state already in use at the depth of the message (e.g. by a host executing another
+/// transaction from a callback) is replaced by a new one, not pooled.
+///
+/// The State is the ExecutionState of the interpreter (ExecutionStatePool) or the one of the
+/// compiler runtime. It is constructed and reset from the message, the revision, the host,
+/// the code and the input data, and has the memory of the execution.
+template <typename State>
+class StatePool
+{
+public:
+    using bytes_view = std::basic_string_view<uint8_t>;
+
+    /// The maximum capacity of the memory of a state returned to the pool. A state whose
+    /// memory has grown more is freed, so one memory-hungry call does not pin the memory.
+    static constexpr size_t max_retained_memory = 4 * 1024 * 1024;
+
+    /// Returns the state to the pool (or frees it).
+    struct Release
+    {
+        StatePool* pool;
+        int depth;  ///< The depth of the pool slot, -1 if not pooled.
+
+        void operator()(State* state) const noexcept
+        {
+            if (depth < 0)
+            {
+                delete state;
+                return;
+            }
+            auto& slot = pool->m_slots[size_t(depth)];
+            slot.in_use = false;
+            if (state->memory.capacity() > max_retained_memory)
+                slot.state.reset();
+        }
+    };
+
+    /// The state being used for the execution of a message.
+    using Handle = std::unique_ptr<State, Release>;
+
+    /// Returns the pool of the calling thread.
+    [[nodiscard]] static StatePool& local() noexcept
+    {
+        thread_local StatePool pool;
+        return pool;
+    }
+
+    /// Returns a state reset for the execution of the message.
+    [[nodiscard]] Handle acquire(const evmc_message& msg, evmc_revision rev,
+        const evmc_host_interface& host, evmc_host_context* ctx, bytes_view code,
+        bytes_view data)
+    {
+        const auto depth = msg.depth;
+        if (depth < 0 || depth > max_call_depth)
+        {
+            ++m_num_allocations;
+            return Handle{new State{msg, rev, host, ctx, code, data}, {this, -1}};
+        }
+
+        m_max_depth = std::max(m_max_depth, depth);
+        if (size_t(depth) >= m_slots.size())
+            m_slots.resize(size_t(depth) + 1);
+        auto& slot = m_slots[size_t(depth)];
+        if (slot.in_use)
+        {
+            // Reentrant execution at the same depth: not pooled.
+            ++m_num_allocations;
+            return Handle{new State{msg, rev, host, ctx, code, data}, {this, -1}};
+        }
+
+        if (slot.state == nullptr)
+        {
+            ++m_num_allocations;
+            slot.state = std::make_unique<State>(msg, rev, host, ctx, code, data);
+        }
+        else
+            slot.state->reset(msg, rev, host, ctx, code, data);
+        slot.in_use = true;
+        return Handle{slot.state.get(), {this, depth}};
+    }
+
+    /// Returns the number of the pooled states.
+    [[nodiscard]] size_t size() const noexcept
+    {
+        size_t n = 0;
+        for (const auto& slot : m_slots)
+            n += slot.state != nullptr;
+        return n;
+    }
+
+    /// Returns the highest call depth of the states acquired so far (the high-water mark),
+    /// -1 if none.
+    [[nodiscard]] int max_depth() const noexcept { return m_max_depth; }
+
+    /// Returns the total memory capacity of the pooled states.
+    [[nodiscard]] size_t memory_capacity() const noexcept
+    {
+        size_t capacity = 0;
+        for (const auto& slot : m_slots)
+        {
+            if (slot.state != nullptr)
+                capacity += slot.state->memory.capacity();
+        }
+        return capacity;
+    }
+
+    /// Returns the number of the states allocated so far, pooled or not.
+    [[nodiscard]] uint64_t num_allocations() const noexcept { return m_num_allocations; }
+
+private:
+    /// The maximum depth of a call (the depth of the top-level call is 0).
+    static constexpr int max_call_depth = 1024;
+
+    struct Slot
+    {
+        std::unique_ptr<State> state;
+        bool in_use = false;
+    };
+
+    /// The slots by the call depth.
+    std::vector<Slot> m_slots;
+
+    int m_max_depth = -1;
+    uint64_t m_num_allocations = 0;
+};
+}  // namespace evmone
@@ -10,6 +10,7 @@
 #include "baseline.hpp"
 #include <evmone/evmone.h>
 #include <cassert>
+#include <charconv>
 #include <iostream>
 
 namespace evmone
@@ -51,6 +52,15 @@ evmc_set_option_result set_option(evmc_vm* c_vm, char const* c_name, char const*
         return EVMC_SET_OPTION_INVALID_NAME;
 #endif
     }
+    else if (name == "analysis-cache")
+    {
+        size_t capacity = 0;
+        const auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), capacity);
+        if (ec != std::errc{} || end != value.data() + value.size())
+            return EVMC_SET_OPTION_INVALID_VALUE;
+        vm.analysis_cache.set_capacity(capacity);
+        return EVMC_SET_OPTION_SUCCESS;
+    }
     else if (name == "trace")
     {
         vm.add_tracer(create_instruction_tracer(std::clog));
@@ -67,7 +77,7 @@ evmc_set_option_result set_option(evmc_vm* c_vm, char const* c_name, char const*
 }  // namespace
 
 
-inline constexpr VM::VM() noexcept
+VM::VM() noexcept
   : evmc_vm{
         EVMC_ABI_VERSION,
         "evmone",
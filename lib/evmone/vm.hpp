@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
+#include "baseline_analysis_cache.hpp"
 #include "tracing.hpp"
 #include <evmc/evmc.h>
 
@@ -20,11 +21,14 @@ class VM : public evmc_vm
 public:
     bool cgoto = EVMONE_CGOTO_SUPPORTED;
 
+    /// The analyses of the code executed by the Baseline interpreter, shared by the threads.
+    baseline::CodeAnalysisCache analysis_cache;
+
 private:
     std::unique_ptr<Tracer> m_first_tracer;
 
 public:
-    inline constexpr VM() noexcept;
+    VM() noexcept;
 
     void add_tracer(std::unique_ptr<Tracer> tracer) noexcept
     {
@@ -61,7 +61,7 @@ BenchmarkCase load_benchmark(const fs::path& path, const std::string& name_prefi
     auto state_test = evmone::test::load_state_test(f);
 
     const auto name = name_prefix + path.stem().string();
-    const auto code = state_test.pre_state.get(state_test.multi_tx.to.value()).code;
+    const auto code = bytes{state_test.pre_state.get(state_test.multi_tx.to.value()).code};
     const auto inputs = load_inputs(state_test);
 
     return BenchmarkCase{name, code, inputs};
@@ -8,6 +8,7 @@
 #include "../test/statetest/statetest.hpp"
 #include "blockchaintest.hpp"
 #include <gtest/gtest.h>
+#include <thread>
 
 namespace evmone::test
 {
@@ -33,6 +34,7 @@ TransitionResult apply_block(state::State& state, evmc::VM& vm, const state::Blo
     const std::vector<state::Transaction>& txs, evmc_revision rev,
     std::optional<int64_t> block_reward)
 {
+    const auto num_threads = std::thread::hardware_concurrency();
     std::vector<state::Log> txs_logs;
     int64_t block_gas_left = block.gas_limit;
 
@@ -63,7 +65,7 @@ TransitionResult apply_block(state::State& state, evmc::VM& vm, const state::Blo
             cumulative_gas_used += receipt.gas_used;
             receipt.cumulative_gas_used = cumulative_gas_used;
             if (rev < EVMC_BYZANTIUM)
-                receipt.post_state = state::mpt_hash(state.get_accounts());
+                receipt.post_state = state.root_hash(num_threads);
 
             block_gas_left -= receipt.gas_used;
             receipts.emplace_back(std::move(receipt));
@@ -98,7 +100,7 @@ std::string print_state(const state::State& s)
         out << key << " : \n";
         out << "\tnonce : " << acc.nonce << "\n";
         out << "\tbalance : " << hex0x(acc.balance) << "\n";
-        out << "\tcode : " << hex0x(acc.code) << "\n";
+        out << "\tcode : " << hex0x(bytes_view{acc.code}) << "\n";
 
         if (!acc.storage.empty())
         {
@@ -125,6 +127,7 @@ void run_blockchain_tests(std::span<const BlockchainTest> tests, evmc::VM& vm)
             std::string{evmc::to_string(c.rev)} + '/' + std::to_string(case_index) + '/' + c.name);
 
         auto state = c.pre_state;
+        const auto num_threads = std::thread::hardware_concurrency();
 
         const state::BlockInfo genesis{
             .number = c.genesis_block_header.block_number,
@@ -144,8 +147,7 @@ void run_blockchain_tests(std::span<const BlockchainTest> tests, evmc::VM& vm)
 
         const auto genesis_res = apply_block(state, vm, genesis, {}, c.rev, {});
 
-        EXPECT_EQ(
-            state::mpt_hash(state.get_accounts()), state::mpt_hash(c.pre_state.get_accounts()));
+        EXPECT_EQ(state.root_hash(num_threads), state::mpt_hash(c.pre_state.get_accounts()));
 
         if (c.rev >= EVMC_SHANGHAI)
         {
@@ -173,8 +175,7 @@ void run_blockchain_tests(std::span<const BlockchainTest> tests, evmc::VM& vm)
             SCOPED_TRACE(std::string{evmc::to_string(c.rev)} + '/' + std::to_string(case_index) +
                          '/' + c.name + '/' + std::to_string(test_block.block_info.number));
 
-            EXPECT_EQ(
-                state::mpt_hash(state.get_accounts()), test_block.expected_block_header.state_root);
+            EXPECT_EQ(state.root_hash(num_threads), test_block.expected_block_header.state_root);
 
             if (c.rev >= EVMC_SHANGHAI)
             {
@@ -197,7 +198,7 @@ void run_blockchain_tests(std::span<const BlockchainTest> tests, evmc::VM& vm)
             std::holds_alternative<state::State>(c.expectation.post_state) ?
                 state::mpt_hash(std::get<state::State>(c.expectation.post_state).get_accounts()) :
                 std::get<hash256>(c.expectation.post_state);
-        EXPECT_TRUE(state::mpt_hash(state.get_accounts()) == post_state_hash)
+        EXPECT_TRUE(state.root_hash(num_threads) == post_state_hash)
             << "Result state:\n"
             << print_state(state)
             << (std::holds_alternative<state::State>(c.expectation.post_state) ?
@@ -0,0 +1,121 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2023 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <test/state/mpt.hpp>
+#include <test/state/rlp.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace
+{
+/// The number of the heap allocations, reported by the benchmarks.
+std::atomic<uint64_t> num_allocations = 0;
+}  // namespace
+
+void* operator new(size_t size)
+{
+    num_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (auto* const p = std::malloc(size != 0 ? size : 1); p != nullptr)
+        return p;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace
+{
+using namespace evmone;
+using namespace evmone::state;
+
+/// Creates the keys and the values of the state trie of the given number of accounts.
+void make_accounts(size_t n, std::vector<hash256>& keys, std::vector<bytes>& values)
+{
+    keys.clear();
+    values.clear();
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        keys.emplace_back(keccak256(bytes32{i}));
+        values.emplace_back(rlp::encode_tuple(i, intx::uint256{i} * 1'000'000'007,
+            keccak256(bytes32{i + n}), keccak256(bytes32{i + 2 * n})));
+    }
+}
+
+void mpt_build_and_hash(benchmark::State& state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    std::vector<hash256> keys;
+    std::vector<bytes> values;
+    make_accounts(n, keys, values);
+
+    uint64_t allocs = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        state.PauseTiming();
+        auto vals = values;
+        const auto allocs_before = num_allocations.load();
+        state.ResumeTiming();
+
+        MPT trie;
+        for (size_t i = 0; i < n; ++i)
+            trie.insert(keys[i], std::move(vals[i]));
+        const auto hash = trie.hash();
+        benchmark::DoNotOptimize(hash);
+
+        allocs += num_allocations.load() - allocs_before;
+    }
+    state.counters["allocs"] =
+        benchmark::Counter(static_cast<double>(allocs), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(mpt_build_and_hash)
+    ->Arg(1'000)
+    ->Arg(10'000)
+    ->Arg(100'000)
+    ->Unit(benchmark::kMillisecond);
+
+void mpt_rehash(benchmark::State& state)
+{
+    // Updates 1% of the values of the trie and recomputes the root hash.
+    const auto n = static_cast<size_t>(state.range(0));
+    std::vector<hash256> keys;
+    std::vector<bytes> values;
+    make_accounts(n, keys, values);
+
+    MPT trie;
+    for (size_t i = 0; i < n; ++i)
+        trie.insert(keys[i], std::move(values[i]));
+    (void)trie.hash();
+
+    uint64_t allocs = 0;
+    uint64_t nonce = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const auto allocs_before = num_allocations.load();
+
+        for (size_t i = nonce % 100; i < n; i += 100)
+            trie.insert(keys[i], rlp::encode(nonce));  // Fits in the short string buffer.
+        const auto hash = trie.hash();
+        benchmark::DoNotOptimize(hash);
+        ++nonce;
+
+        allocs += num_allocations.load() - allocs_before;
+    }
+    state.counters["allocs"] =
+        benchmark::Counter(static_cast<double>(allocs), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(mpt_rehash)->Arg(1'000)->Arg(10'000)->Arg(100'000)->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
+#include "code.hpp"
 #include <evmc/evmc.hpp>
 #include <intx/intx.hpp>
 #include <unordered_map>
@@ -43,7 +44,7 @@ struct Account
     std::unordered_map<bytes32, bytes32> transient_storage = {};
 
     /// The account code.
-    bytes code = {};
+    Code code = {};
 
     /// The account has been destructed and should be erased at the end of of a transaction.
     bool destructed = false;
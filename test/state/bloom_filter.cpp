@@ -10,13 +10,11 @@ namespace evmone::state
 
 namespace
 {
-/// Adds an entry to the bloom filter.
+/// Adds an entry, given by its hash, to the bloom filter.
 /// based on
 /// https://ethereum.github.io/execution-specs/autoapi/ethereum/shanghai/bloom/index.html#add-to-bloom
-inline void add_to(BloomFilter& bf, const bytes_view& entry)
+inline void add_to(BloomFilter& bf, const hash256& hash)
 {
-    const auto hash = keccak256(entry);
-
     // take the least significant 11-bits of the first three 16-bit values
     for (const auto i : {0, 2, 4})
     {
@@ -33,12 +31,31 @@ inline void add_to(BloomFilter& bf, const bytes_view& entry)
 BloomFilter compute_bloom_filter(std::span<const Log> logs) noexcept
 {
     BloomFilter res;
+
+    // The entries are hashed in batches.
+    static constexpr size_t batch_size = 16;
+    bytes_view entries[batch_size];
+    hash256 hashes[batch_size];
+    size_t num_entries = 0;
+    const auto flush = [&] {
+        keccak256_batch({entries, num_entries}, {hashes, num_entries});
+        for (size_t i = 0; i < num_entries; ++i)
+            add_to(res, hashes[i]);
+        num_entries = 0;
+    };
+    const auto add = [&](bytes_view entry) {
+        entries[num_entries++] = entry;
+        if (num_entries == batch_size)
+            flush();
+    };
+
     for (const auto& log : logs)
     {
-        add_to(res, log.addr);
+        add(log.addr);
         for (const auto& topic : log.topics)
-            add_to(res, topic);
+            add(topic);
     }
+    flush();
 
     return res;
 }
@@ -0,0 +1,39 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2023 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "code.hpp"
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+namespace evmone::state
+{
+std::shared_ptr<const Code::Blob> Code::intern(bytes_view code)
+{
+    if (code.empty())
+        return nullptr;
+
+    // The blobs are held by the accounts only: the store keeps weak references,
+    // and the expired ones are swept when the store has doubled its size.
+    static constexpr size_t min_sweep_size = 1024;
+    static std::mutex mutex;
+    static std::unordered_map<hash256, std::weak_ptr<const Blob>> blobs;
+    static size_t sweep_size = min_sweep_size;
+
+    const auto hash = keccak256(code);
+    const std::lock_guard lock{mutex};
+    auto& weak_blob = blobs[hash];
+    if (auto blob = weak_blob.lock())
+        return blob;
+
+    auto blob = std::make_shared<const Blob>(Blob{bytes{code}, hash});
+    weak_blob = blob;
+    if (blobs.size() >= sweep_size)
+    {
+        std::erase_if(blobs, [](const auto& entry) { return entry.second.expired(); });
+        sweep_size = std::max(min_sweep_size, 2 * blobs.size());
+    }
+    return blob;
+}
+}  // namespace evmone::state
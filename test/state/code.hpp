@@ -0,0 +1,65 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2023 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "hash_utils.hpp"
+#include <initializer_list>
+#include <memory>
+
+namespace evmone::state
+{
+/// The hash of the empty code, i.e. keccak256({}).
+static constexpr auto EmptyCodeHash =
+    0xc5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470_bytes32;
+
+/// The immutable account code.
+///
+/// The code bytes are kept in a reference-counted blob together with their hash. The blobs are
+/// interned by the hash: the accounts having the same code (e.g. proxies and clones) share one
+/// blob, and copying the code of an account only copies the reference. The code pointer is
+/// stable for the lifetime of the blob, so the code can be passed to the VM without copying
+/// and the VM caches keyed by the code address are shared by all the accounts with this code.
+class Code
+{
+    struct Blob
+    {
+        bytes code;
+        hash256 hash;
+    };
+
+    /// The blob of the code, null for the empty code.
+    std::shared_ptr<const Blob> m_blob;
+
+    [[nodiscard]] static std::shared_ptr<const Blob> intern(bytes_view code);
+
+public:
+    Code() noexcept = default;
+
+    Code(bytes_view code) : m_blob{intern(code)} {}
+    Code(const bytes& code) : Code{bytes_view{code}} {}
+    Code(std::initializer_list<uint8_t> code) : Code{bytes_view{code.begin(), code.size()}} {}
+
+    [[nodiscard]] const uint8_t* data() const noexcept
+    {
+        return m_blob != nullptr ? m_blob->code.data() : nullptr;
+    }
+
+    [[nodiscard]] size_t size() const noexcept
+    {
+        return m_blob != nullptr ? m_blob->code.size() : 0;
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return m_blob == nullptr; }
+
+    /// Returns the keccak256 hash of the code (computed once, when the code is created).
+    [[nodiscard]] const hash256& hash() const noexcept
+    {
+        return m_blob != nullptr ? m_blob->hash : EmptyCodeHash;
+    }
+
+    operator bytes_view() const noexcept { return {data(), size()}; }
+
+    friend bool operator==(const Code& a, bytes_view b) noexcept { return bytes_view{a} == b; }
+};
+}  // namespace evmone::state
@@ -2,6 +2,186 @@
 // Copyright 2023 The evmone Authors.
 // SPDX-License-Identifier: Apache-2.0
 #include "hash_utils.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define EVMONE_KECCAK_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace evmone
+{
+#if EVMONE_KECCAK_AVX2
+namespace
+{
+/// The size of the block (the rate) of Keccak-256 in bytes.
+constexpr size_t keccak256_block_size = 136;
+
+/// The number of inputs hashed at once: one per 64-bit lane of a 256-bit vector.
+constexpr size_t num_lanes = 4;
+
+constexpr uint64_t round_constants[24] = {
+    0x0000000000000001,
+    0x0000000000008082,
+    0x800000000000808a,
+    0x8000000080008000,
+    0x000000000000808b,
+    0x0000000080000001,
+    0x8000000080008081,
+    0x8000000000008009,
+    0x000000000000008a,
+    0x0000000000000088,
+    0x0000000080008009,
+    0x000000008000000a,
+    0x000000008000808b,
+    0x800000000000008b,
+    0x8000000000008089,
+    0x8000000000008003,
+    0x8000000000008002,
+    0x8000000000000080,
+    0x000000000000800a,
+    0x800000008000000a,
+    0x8000000080008081,
+    0x8000000000008080,
+    0x0000000080000001,
+    0x8000000080008008,
+};
+
+/// The rotation offsets of the state words (indexed by x + 5 * y).
+constexpr int rotations[25] = {
+    0, 1, 62, 28, 27, 36, 44, 6, 55, 20, 3, 10, 43, 25, 39, 41, 45, 15, 21, 8, 18, 2, 61, 56, 14};
+
+__attribute__((target("avx2"))) inline __m256i rotl(__m256i x, int n) noexcept
+{
+    return _mm256_or_si256(_mm256_sllv_epi64(x, _mm256_set1_epi64x(n)),
+        _mm256_srlv_epi64(x, _mm256_set1_epi64x(64 - n)));
+}
+
+/// The Keccak-f[1600] permutation of 4 states, one in each lane.
+__attribute__((target("avx2"))) void keccakf1600x4(__m256i a[25]) noexcept
+{
+    for (const auto rc : round_constants)
+    {
+        // Theta.
+        __m256i c[5];
+        for (int x = 0; x < 5; ++x)
+        {
+            c[x] = _mm256_xor_si256(_mm256_xor_si256(a[x], a[x + 5]),
+                _mm256_xor_si256(_mm256_xor_si256(a[x + 10], a[x + 15]), a[x + 20]));
+        }
+        for (int x = 0; x < 5; ++x)
+        {
+            const auto d = _mm256_xor_si256(c[(x + 4) % 5], rotl(c[(x + 1) % 5], 1));
+            for (int y = 0; y < 25; y += 5)
+                a[x + y] = _mm256_xor_si256(a[x + y], d);
+        }
+
+        // Rho and pi.
+        __m256i b[25];
+        for (int x = 0; x < 5; ++x)
+        {
+            for (int y = 0; y < 5; ++y)
+                b[y + 5 * ((2 * x + 3 * y) % 5)] = rotl(a[x + 5 * y], rotations[x + 5 * y]);
+        }
+
+        // Chi.
+        for (int y = 0; y < 25; y += 5)
+        {
+            for (int x = 0; x < 5; ++x)
+            {
+                a[x + y] = _mm256_xor_si256(
+                    b[x + y], _mm256_andnot_si256(b[(x + 1) % 5 + y], b[(x + 2) % 5 + y]));
+            }
+        }
+
+        // Iota.
+        a[0] = _mm256_xor_si256(a[0], _mm256_set1_epi64x(static_cast<int64_t>(rc)));
+    }
+}
+
+/// Hashes up to 4 inputs at once. The blocks of the inputs are absorbed in lockstep:
+/// the lanes of the shorter inputs absorb nothing after their last block and their hashes
+/// are extracted right after it.
+__attribute__((target("avx2"))) void keccak256x4(
+    const bytes_view* inputs, hash256* hashes, size_t n) noexcept
+{
+    assert(n <= num_lanes);
+    static constexpr size_t block_words = keccak256_block_size / sizeof(uint64_t);
+
+    size_t num_blocks[num_lanes]{};
+    size_t max_num_blocks = 0;
+    for (size_t l = 0; l < n; ++l)
+    {
+        // The padding takes at least one byte, possibly in an additional block.
+        num_blocks[l] = inputs[l].size() / keccak256_block_size + 1;
+        max_num_blocks = std::max(max_num_blocks, num_blocks[l]);
+    }
+
+    __m256i state[25];
+    std::fill_n(state, std::size(state), _mm256_setzero_si256());
+    for (size_t block = 0; block < max_num_blocks; ++block)
+    {
+        alignas(32) uint64_t words[block_words][num_lanes]{};
+        for (size_t l = 0; l < n; ++l)
+        {
+            if (block >= num_blocks[l])
+                continue;
+
+            uint8_t buf[keccak256_block_size]{};
+            const auto data = inputs[l].substr(block * keccak256_block_size);
+            const auto size = std::min(data.size(), keccak256_block_size);
+            std::copy_n(data.data(), size, buf);
+            if (block == num_blocks[l] - 1)
+            {
+                buf[size] ^= 0x01;
+                buf[keccak256_block_size - 1] ^= 0x80;
+            }
+            for (size_t w = 0; w < block_words; ++w)
+                std::memcpy(&words[w][l], &buf[w * sizeof(uint64_t)], sizeof(uint64_t));
+        }
+        for (size_t w = 0; w < block_words; ++w)
+        {
+            state[w] = _mm256_xor_si256(
+                state[w], _mm256_load_si256(reinterpret_cast<const __m256i*>(words[w])));
+        }
+
+        keccakf1600x4(state);
+
+        for (size_t l = 0; l < n; ++l)
+        {
+            if (block != num_blocks[l] - 1)
+                continue;
+            for (size_t w = 0; w < sizeof(hash256) / sizeof(uint64_t); ++w)
+            {
+                alignas(32) uint64_t lanes[num_lanes];
+                _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), state[w]);
+                std::memcpy(&hashes[l].bytes[w * sizeof(uint64_t)], &lanes[l], sizeof(uint64_t));
+            }
+        }
+    }
+}
+}  // namespace
+#endif
+
+void keccak256_batch(std::span<const bytes_view> inputs, std::span<hash256> hashes) noexcept
+{
+    assert(hashes.size() >= inputs.size());
+    size_t i = 0;
+#if EVMONE_KECCAK_AVX2
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    if (has_avx2)
+    {
+        // A single remaining input is hashed alone.
+        for (; i + 1 < inputs.size(); i += num_lanes)
+            keccak256x4(&inputs[i], &hashes[i], std::min(inputs.size() - i, num_lanes));
+    }
+#endif
+    for (; i < inputs.size(); ++i)
+        hashes[i] = keccak256(inputs[i]);
+}
+}  // namespace evmone
 
 std::ostream& operator<<(std::ostream& out, const evmone::address& a)
 {
@@ -8,6 +8,7 @@
 #include <evmc/evmc.hpp>
 #include <evmc/hex.hpp>
 #include <bit>
+#include <span>
 
 namespace evmone
 {
@@ -31,6 +32,12 @@ inline hash256 keccak256(bytes_view data) noexcept
 {
     return std::bit_cast<hash256>(ethash::keccak256(data.data(), data.size()));
 }
+
+/// Computes Keccak hashes of multiple inputs: hashes[i] = keccak256(inputs[i]).
+///
+/// On x86-64 CPUs with AVX2, 4 inputs are hashed at once, one in each 64-bit lane of the vector
+/// registers. This pays off for many small inputs (keys, addresses, trie nodes) of similar sizes.
+void keccak256_batch(std::span<const bytes_view> inputs, std::span<hash256> hashes) noexcept;
 }  // namespace evmone
 
 std::ostream& operator<<(std::ostream& out, const evmone::address& a);
@@ -29,7 +29,7 @@ evmc_storage_status Host::set_storage(
     // Follow EVMC documentation https://evmc.ethereum.org/storagestatus.html#autotoc_md3
     // and EIP-2200 specification https://eips.ethereum.org/EIPS/eip-2200.
 
-    auto& storage_slot = m_state.get(addr).storage[key];
+    auto& storage_slot = m_state.update_storage(addr, key);
     const auto& [current, original, _] = storage_slot;
 
     const auto dirty = original != current;
@@ -82,9 +82,8 @@ size_t Host::get_code_size(const address& addr) const noexcept
 
 bytes32 Host::get_code_hash(const address& addr) const noexcept
 {
-    // TODO: Cache code hash. It will be needed also to compute the MPT hash.
     const auto* const acc = m_state.find(addr);
-    return (acc != nullptr && !acc->is_empty()) ? keccak256(acc->code) : bytes32{};
+    return (acc != nullptr && !acc->is_empty()) ? acc->code.hash() : bytes32{};
 }
 
 size_t Host::copy_code(const address& addr, size_t code_offset, uint8_t* buffer_data,
@@ -104,11 +103,18 @@ bool Host::selfdestruct(const address& addr, const address& beneficiary) noexcep
     // This may happen multiple times per single account as account's balance
     // can be increased with a call following previous selfdestruct.
     auto& acc = m_state.get(addr);
-    m_state.touch(beneficiary).balance += acc.balance;
+    auto& beneficiary_acc = m_state.touch(beneficiary);
+    m_state.journal_balance_change(beneficiary, beneficiary_acc.balance);
+    beneficiary_acc.balance += acc.balance;
+    m_state.journal_balance_change(addr, acc.balance);
     acc.balance = 0;  // Zero balance (this can be the beneficiary).
 
     // Mark the destruction if not done already.
-    return !std::exchange(acc.destructed, true);
+    if (acc.destructed)
+        return false;
+    m_state.journal_destruct(addr);
+    acc.destructed = true;
+    return true;
 }
 
 address compute_new_account_address(const address& sender, uint64_t sender_nonce,
@@ -148,6 +154,7 @@ std::optional<evmc_message> Host::prepare_message(evmc_message msg)
     {
         if (sender_nonce == Account::NonceMax)
             return {};  // Light early exception, cannot happen for depth == 0.
+        m_state.journal_nonce_change(msg.sender, sender_nonce);
         ++sender_acc.nonce;
     }
 
@@ -181,17 +188,25 @@ evmc::Result Host::create(const evmc_message& msg) noexcept
     auto& new_acc = m_state.get_or_insert(msg.recipient);
     assert(new_acc.nonce == 0);
     if (m_rev >= EVMC_SPURIOUS_DRAGON)
+    {
+        m_state.journal_nonce_change(msg.recipient, new_acc.nonce);
         new_acc.nonce = 1;
+    }
 
     // Clear the new account storage, but keep the access status (from tx access list).
     // This is only needed for tests and cannot happen in real networks.
-    for (auto& [_, v] : new_acc.storage) [[unlikely]]
-        v = StorageValue{.access_status = v.access_status};
+    for (const auto& [key, _] : new_acc.storage) [[unlikely]]
+    {
+        auto& slot = m_state.update_storage(msg.recipient, key);
+        slot = StorageValue{.access_status = slot.access_status};
+    }
 
     auto& sender_acc = m_state.get(msg.sender);  // TODO: Duplicated account lookup.
     const auto value = intx::be::load<intx::uint256>(msg.value);
     assert(sender_acc.balance >= value && "EVM must guarantee balance");
+    m_state.journal_balance_change(msg.sender, sender_acc.balance);
     sender_acc.balance -= value;
+    m_state.journal_balance_change(msg.recipient, new_acc.balance);
     new_acc.balance += value;  // The new account may be prefunded.
 
     auto create_msg = msg;
@@ -236,9 +251,9 @@ evmc::Result Host::create(const evmc_message& msg) noexcept
     else if (m_rev >= EVMC_LONDON && !code.empty() && code[0] == 0xEF)  // Reject EF code.
         return evmc::Result{EVMC_CONTRACT_VALIDATION_FAILURE};
 
-    // TODO: The new_acc pointer is invalid because of the state revert implementation,
-    //       but this should change if state journal is implemented.
-    m_state.get(msg.recipient).code = code;
+    // The new account has been inserted before the execution, so the nested reverts keep it.
+    m_state.journal_code_change(msg.recipient, std::move(new_acc.code));
+    new_acc.code = code;
 
     return evmc::Result{result.status_code, gas_left, result.gas_refund, msg.recipient};
 }
@@ -256,16 +271,20 @@ evmc::Result Host::execute_message(const evmc_message& msg) noexcept
     {
         // Transfer value.
         const auto value = intx::be::load<intx::uint256>(msg.value);
-        assert(m_state.get(msg.sender).balance >= value);
-        m_state.get(msg.sender).balance -= value;
+        auto& sender_acc = m_state.get(msg.sender);
+        assert(sender_acc.balance >= value);
+        m_state.journal_balance_change(msg.sender, sender_acc.balance);
+        sender_acc.balance -= value;
+        m_state.journal_balance_change(msg.recipient, dst_acc->balance);
         dst_acc->balance += value;
     }
 
     if (auto precompiled_result = call_precompile(m_rev, msg); precompiled_result.has_value())
         return std::move(*precompiled_result);
 
-    // Copy of the code. Revert will invalidate the account.
-    const auto code = dst_acc != nullptr ? dst_acc->code : bytes{};
+    // The code is not copied: the reverts of the nested calls keep the account
+    // and the code of an existing account cannot change.
+    const auto code = dst_acc != nullptr ? bytes_view{dst_acc->code} : bytes_view{};
     return m_vm.execute(*this, m_rev, msg, code.data(), code.size());
 }
 
@@ -275,7 +294,7 @@ evmc::Result Host::call(const evmc_message& orig_msg) noexcept
     if (!msg.has_value())
         return evmc::Result{EVMC_FAILURE, orig_msg.gas};  // Light exception.
 
-    auto state_snapshot = m_state;
+    const auto checkpoint = m_state.checkpoint();
     const auto logs_snapshot = m_logs.size();
 
     auto result = execute_message(*msg);
@@ -287,7 +306,7 @@ evmc::Result Host::call(const evmc_message& orig_msg) noexcept
         const auto is_03_touched = acc_03 != nullptr && acc_03->erasable;
 
         // Revert.
-        m_state = std::move(state_snapshot);
+        m_state.rollback(checkpoint);
         m_logs.resize(logs_snapshot);
 
         // The 0x03 quirk: the touch on this address is never reverted.
@@ -346,6 +365,8 @@ evmc_access_status Host::access_account(const address& addr) noexcept
 
     auto& acc = m_state.get_or_insert(addr, {.erasable = true});
     const auto status = std::exchange(acc.access_status, EVMC_ACCESS_WARM);
+    if (status == EVMC_ACCESS_COLD)
+        m_state.journal_access_account(addr);
 
     // Overwrite status for precompiled contracts: they are always warm.
     if (status == EVMC_ACCESS_COLD && addr >= 0x01_address && addr <= 0x09_address)
@@ -356,7 +377,12 @@ evmc_access_status Host::access_account(const address& addr) noexcept
 
 evmc_access_status Host::access_storage(const address& addr, const bytes32& key) noexcept
 {
-    return std::exchange(m_state.get(addr).storage[key].access_status, EVMC_ACCESS_WARM);
+    // Only the first access changes the state (and is journaled).
+    const auto& storage = m_state.get(addr).storage;
+    if (const auto it = storage.find(key);
+        it != storage.end() && it->second.access_status == EVMC_ACCESS_WARM)
+        return EVMC_ACCESS_WARM;
+    return std::exchange(m_state.update_storage(addr, key).access_status, EVMC_ACCESS_WARM);
 }
 
 
@@ -370,6 +396,6 @@ evmc::bytes32 Host::get_transient_storage(const address& addr, const bytes32& ke
 void Host::set_transient_storage(
     const address& addr, const bytes32& key, const bytes32& value) noexcept
 {
-    m_state.get(addr).transient_storage[key] = value;
+    m_state.update_transient_storage(addr, key) = value;
 }
 }  // namespace evmone::state
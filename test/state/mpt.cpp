@@ -3,9 +3,13 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "mpt.hpp"
+#include "parallel.hpp"
 #include "rlp.hpp"
 #include <algorithm>
 #include <cassert>
+#include <new>
+#include <utility>
+#include <vector>
 
 namespace evmone::state
 {
@@ -40,6 +44,15 @@ struct Path
         return p;
     }
 
+    /// Returns the path of the single nibble.
+    [[nodiscard]] static Path nibble(uint8_t n) noexcept
+    {
+        Path p;
+        p.length = 1;
+        p.nibbles[0] = n;
+        return p;
+    }
+
     [[nodiscard]] Path head(size_t size) const noexcept
     {
         assert(size < length);  // MPT never requests whole path copy (size == length).
@@ -49,29 +62,122 @@ struct Path
         return p;
     }
 
-    [[nodiscard]] bytes encode(bool extended) const
+    /// Returns the concatenation of the paths.
+    [[nodiscard]] Path operator+(const Path& other) const noexcept
+    {
+        assert(length + other.length <= std::size(nibbles));
+        Path p = *this;
+        std::copy_n(other.nibbles, other.length, &p.nibbles[length]);
+        p.length += other.length;
+        return p;
+    }
+
+    [[nodiscard]] bool operator==(const Path& other) const noexcept
     {
-        bytes bs;
+        return length == other.length && std::equal(nibbles, nibbles + length, other.nibbles);
+    }
+
+    /// The maximum size of the hex-prefix encoding of a path.
+    static constexpr size_t max_encoded_size = sizeof(nibbles) / 2 + 1;
+
+    /// Writes the hex-prefix encoding of the path to the output
+    /// of max_encoded_size bytes. Returns the encoding.
+    [[nodiscard]] bytes_view encode(uint8_t* out, bool extended) const noexcept
+    {
+        size_t size = 0;
         const auto is_even = length % 2 == 0;
         if (is_even)
-            bs.push_back(0x00);
+            out[size++] = 0x00;
         else
-            bs.push_back(0x10 | nibbles[0]);
+            out[size++] = 0x10 | nibbles[0];
         for (size_t i = is_even ? 0 : 1; i < length; ++i)
         {
             const auto h = nibbles[i++];
             const auto l = nibbles[i];
             assert(h <= 0x0f);
             assert(l <= 0x0f);
-            bs.push_back(static_cast<uint8_t>((h << 4) | l));
+            out[size++] = static_cast<uint8_t>((h << 4) | l);
         }
         if (!extended)
-            bs[0] |= 0x20;
-        return bs;
+            out[0] |= 0x20;
+        return {out, size};
+    }
+};
+
+/// The reference to a node as encoded in its parent: the node encoding if shorter than 32 bytes,
+/// the RLP-encoded hash of the encoding otherwise. Stored inline, it takes no allocation.
+class NodeRef
+{
+    static constexpr size_t max_size = 1 + sizeof(hash256);
+
+    uint8_t m_size = 0;  ///< Zero if the reference is not computed.
+    uint8_t m_data[max_size]{};
+
+public:
+    [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+    void clear() noexcept { m_size = 0; }
+
+    [[nodiscard]] bytes_view view() const noexcept { return {m_data, m_size}; }
+
+    /// Sets the reference to the node encoding, if shorter than 32 bytes, or to its hash.
+    void assign(bytes_view encoding) noexcept
+    {
+        if (encoding.size() < 32)
+        {
+            std::copy(encoding.begin(), encoding.end(), m_data);
+            m_size = static_cast<uint8_t>(encoding.size());
+        }
+        else
+            assign(keccak256(encoding));
+    }
+
+    /// Sets the reference to the hash of the node encoding.
+    void assign(const hash256& hash) noexcept
+    {
+        m_data[0] = 0xa0;  // RLP prefix of 32-byte string.
+        std::copy_n(hash.bytes, sizeof(hash), &m_data[1]);
+        m_size = max_size;
     }
 };
+
+/// Returns the thread's buffer for the node encodings, reused by all the tries.
+bytes& encoding_buffer() noexcept
+{
+    thread_local bytes buffer;
+    return buffer;
+}
 }  // namespace
 
+/// The allocator of the MPT nodes.
+///
+/// The nodes are bump-allocated in blocks of growing sizes, and the slots of the nodes freed
+/// by the modifications of the trie are reused. The arena must outlive its nodes.
+/// The blocks double from a single node: most storage tries have a few nodes only.
+class MPTNodeArena
+{
+    static constexpr size_t min_block_size = 1;
+    static constexpr size_t max_block_size_shift = 12;  // Blocks of at most 4096 nodes.
+
+    /// The freed slot, linking the next one.
+    struct FreeSlot
+    {
+        FreeSlot* next;
+    };
+
+    std::vector<std::unique_ptr<std::byte[]>> m_blocks;
+    std::byte* m_next = nullptr;  ///< The next unused slot of the last block.
+    std::byte* m_end = nullptr;   ///< The end of the last block.
+    FreeSlot* m_free = nullptr;   ///< The list of the freed slots.
+
+public:
+    /// Moves the node into a new slot.
+    [[nodiscard]] MPTNode* make(MPTNode&& node);
+
+    /// Destroys the node and frees its slot.
+    void destroy(MPTNode* node) noexcept;
+};
+
 /// The MPT Node.
 ///
 /// The implementation is based on StackTrie from go-ethereum.
@@ -91,45 +197,71 @@ class MPTNode
     Kind m_kind = Kind::leaf;
     Path m_path;
     bytes m_value;
-    std::unique_ptr<MPTNode> m_children[num_children];
+    MPTNode* m_children[num_children]{};
+
+    /// The memoized reference to the node (see ref()), empty if not computed since
+    /// the last modification of the node or of its descendants.
+    mutable NodeRef m_ref;
 
     explicit MPTNode(Kind kind, const Path& path = {}, bytes&& value = {}) noexcept
       : m_kind{kind}, m_path{path}, m_value{std::move(value)}
     {}
 
     /// Creates an extended node.
-    static MPTNode ext(const Path& path, std::unique_ptr<MPTNode> child) noexcept
+    static MPTNode ext(const Path& path, MPTNode* child) noexcept
     {
         assert(child->m_kind == Kind::branch);
         MPTNode node{Kind::ext, path};
-        node.m_children[0] = std::move(child);
+        node.m_children[0] = child;
         return node;
     }
 
     /// Optionally wraps the child node with newly created extended node in case
     /// the provided path is not empty.
-    static std::unique_ptr<MPTNode> optional_ext(
-        const Path& path, std::unique_ptr<MPTNode> child) noexcept
+    static MPTNode* optional_ext(MPTNodeArena& arena, const Path& path, MPTNode* child)
     {
-        return (path.length != 0) ? std::make_unique<MPTNode>(ext(path, std::move(child))) :
-                                    std::move(child);
+        return (path.length != 0) ? arena.make(ext(path, child)) : child;
     }
 
     /// Creates a branch node out of two children and optionally extends it with an extended
     /// node in case the path is not empty.
-    static MPTNode ext_branch(const Path& path, size_t idx1, std::unique_ptr<MPTNode> child1,
-        size_t idx2, std::unique_ptr<MPTNode> child2) noexcept
+    static MPTNode ext_branch(MPTNodeArena& arena, const Path& path, size_t idx1,
+        MPTNode* child1, size_t idx2, MPTNode* child2)
     {
         assert(idx1 != idx2);
         assert(idx1 < num_children);
         assert(idx2 < num_children);
 
         MPTNode br{Kind::branch};
-        br.m_children[idx1] = std::move(child1);
-        br.m_children[idx2] = std::move(child2);
+        br.m_children[idx1] = child1;
+        br.m_children[idx2] = child2;
 
-        return (path.length != 0) ? ext(path, std::make_unique<MPTNode>(std::move(br))) :
-                                    std::move(br);
+        return (path.length != 0) ? ext(path, arena.make(std::move(br))) : std::move(br);
+    }
+
+    /// Creates the node replacing an ext or branch node left with the single child,
+    /// reached by the path (the ext path or the branch index).
+    /// The leaf and ext child nodes are merged into the new node and destroyed.
+    static MPTNode merge(MPTNodeArena& arena, const Path& path, MPTNode* child) noexcept
+    {
+        switch (child->m_kind)
+        {
+        case Kind::leaf:
+        {
+            MPTNode node{Kind::leaf, path + child->m_path, std::move(child->m_value)};
+            arena.destroy(child);
+            return node;
+        }
+        case Kind::ext:
+        {
+            auto node = ext(path + child->m_path, child->m_children[0]);
+            arena.destroy(child);
+            return node;
+        }
+        case Kind::branch:
+        default:
+            return ext(path, child);
+        }
     }
 
     /// Finds the position at witch two paths differ.
@@ -140,26 +272,93 @@ class MPTNode
             std::mismatch(p1.nibbles, p1.nibbles + p1.length, p2.nibbles).first - p1.nibbles);
     }
 
+    /// Appends the RLP encoding of the node to the output.
+    /// The references to the children must be computed.
+    void encode(bytes& out) const;
+
+    /// Computes the references to the modified descendants, hashing the encodings of the
+    /// modified children of a branch in a batch. The encodings are built at the end of the buffer,
+    /// which is restored to its original size on return.
+    void compute_children_refs(bytes& buf) const;
+
 public:
     MPTNode() = default;
 
     /// Creates new leaf node.
-    static std::unique_ptr<MPTNode> leaf(const Path& path, bytes&& value) noexcept
+    static MPTNode* leaf(MPTNodeArena& arena, const Path& path, bytes&& value)
     {
-        return std::make_unique<MPTNode>(MPTNode{Kind::leaf, path, std::move(value)});
+        return arena.make(MPTNode{Kind::leaf, path, std::move(value)});
     }
 
-    void insert(const Path& path, bytes&& value);
+    /// Destroys the node and its descendants.
+    static void destroy(MPTNodeArena& arena, MPTNode* node) noexcept;
+
+    void insert(MPTNodeArena& arena, const Path& path, bytes&& value);
+
+    /// Erases the value at the path. Returns true if the node has become empty
+    /// and must be removed by the parent.
+    [[nodiscard]] bool erase(MPTNodeArena& arena, const Path& path);
+
+    /// Returns the reference to the node as encoded in its parent: the node encoding
+    /// if shorter than 32 bytes, the RLP-encoded hash of the encoding otherwise.
+    /// The buffer is used for the encodings, as in compute_children_refs().
+    [[nodiscard]] bytes_view ref(bytes& buf) const;
 
-    [[nodiscard]] bytes encode() const;
+    /// Computes the references to the subtries of the topmost branch node in parallel.
+    void compute_subtrie_refs(unsigned num_threads) const;
 };
 
-void MPTNode::insert(const Path& path, bytes&& value)  // NOLINT(misc-no-recursion)
+static_assert(alignof(MPTNode) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+
+MPTNode* MPTNodeArena::make(MPTNode&& node)
+{
+    void* slot = nullptr;
+    if (m_free != nullptr)
+    {
+        slot = m_free;
+        m_free = m_free->next;
+    }
+    else
+    {
+        if (m_next == m_end)
+        {
+            const auto block_size = min_block_size
+                                    << std::min(m_blocks.size(), max_block_size_shift);
+            std::unique_ptr<std::byte[]> block{new std::byte[block_size * sizeof(MPTNode)]};
+            m_next = block.get();
+            m_end = m_next + block_size * sizeof(MPTNode);
+            m_blocks.emplace_back(std::move(block));
+        }
+        slot = m_next;
+        m_next += sizeof(MPTNode);
+    }
+    return ::new (slot) MPTNode{std::move(node)};
+}
+
+void MPTNodeArena::destroy(MPTNode* node) noexcept
+{
+    node->~MPTNode();
+    m_free = ::new (static_cast<void*>(node)) FreeSlot{m_free};
+}
+
+void MPTNode::destroy(MPTNodeArena& arena, MPTNode* node) noexcept  // NOLINT(misc-no-recursion)
+{
+    for (auto* child : node->m_children)
+    {
+        if (child != nullptr)
+            destroy(arena, child);
+    }
+    arena.destroy(node);
+}
+
+void MPTNode::insert(  // NOLINT(misc-no-recursion)
+    MPTNodeArena& arena, const Path& path, bytes&& value)
 {
     // The insertion is all about branch nodes. In happy case we will find an empty slot
     // in an existing branch node. Otherwise, we need to create new branch node
     // (possibly with an adjusted extended node) and transform existing nodes around it.
 
+    m_ref.clear();
     switch (m_kind)
     {
     case Kind::branch:
@@ -168,10 +367,10 @@ void MPTNode::insert(const Path& path, bytes&& value)  // NOLINT(misc-no-recursi
 
         const auto idx = path.nibbles[0];
         auto& child = m_children[idx];
-        if (!child)
-            child = leaf(path.tail(1), std::move(value));
+        if (child == nullptr)
+            child = leaf(arena, path.tail(1), std::move(value));
         else
-            child->insert(path.tail(1), std::move(value));
+            child->insert(arena, path.tail(1), std::move(value));
         break;
     }
 
@@ -182,35 +381,36 @@ void MPTNode::insert(const Path& path, bytes&& value)  // NOLINT(misc-no-recursi
         const auto mismatch_pos = mismatch(m_path, path);
 
         if (mismatch_pos == m_path.length)  // Paths match: go into the child.
-            return m_children[0]->insert(path.tail(mismatch_pos), std::move(value));
+            return m_children[0]->insert(arena, path.tail(mismatch_pos), std::move(value));
 
         const auto orig_idx = m_path.nibbles[mismatch_pos];
         const auto new_idx = path.nibbles[mismatch_pos];
 
         // The original branch node must be pushed down, possible extended with
         // the adjusted extended node if the path split point is not directly at the branch node.
-        // Clang Analyzer bug: https://github.com/llvm/llvm-project/issues/47814
-        // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
-        auto orig_branch = optional_ext(m_path.tail(mismatch_pos + 1), std::move(m_children[0]));
-        auto new_leaf = leaf(path.tail(mismatch_pos + 1), std::move(value));
-        *this = ext_branch(m_path.head(mismatch_pos), orig_idx, std::move(orig_branch), new_idx,
-            std::move(new_leaf));
+        auto* const orig_branch = optional_ext(arena, m_path.tail(mismatch_pos + 1), m_children[0]);
+        auto* const new_leaf = leaf(arena, path.tail(mismatch_pos + 1), std::move(value));
+        *this = ext_branch(
+            arena, m_path.head(mismatch_pos), orig_idx, orig_branch, new_idx, new_leaf);
         break;
     }
 
     case Kind::leaf:
     {
-        assert(m_path.length != 0);  // Leaf must have non-empty path.
-
         const auto mismatch_pos = mismatch(m_path, path);
-        assert(mismatch_pos != m_path.length);  // Paths must be different.
+        if (mismatch_pos == m_path.length)  // Paths match: replace the value.
+        {
+            assert(path.length == m_path.length);  // Keys must be prefix-free.
+            m_value = std::move(value);
+            break;
+        }
 
         const auto orig_idx = m_path.nibbles[mismatch_pos];
         const auto new_idx = path.nibbles[mismatch_pos];
-        auto orig_leaf = leaf(m_path.tail(mismatch_pos + 1), std::move(m_value));
-        auto new_leaf = leaf(path.tail(mismatch_pos + 1), std::move(value));
-        *this = ext_branch(m_path.head(mismatch_pos), orig_idx, std::move(orig_leaf), new_idx,
-            std::move(new_leaf));
+        auto* const orig_leaf = leaf(arena, m_path.tail(mismatch_pos + 1), std::move(m_value));
+        auto* const new_leaf = leaf(arena, path.tail(mismatch_pos + 1), std::move(value));
+        *this =
+            ext_branch(arena, m_path.head(mismatch_pos), orig_idx, orig_leaf, new_idx, new_leaf);
         break;
     }
 
@@ -219,24 +419,74 @@ void MPTNode::insert(const Path& path, bytes&& value)  // NOLINT(misc-no-recursi
     }
 }
 
-/// Encodes a node and optionally hashes the encoded bytes
-/// if their length exceeds the specified threshold.
-static bytes encode_child(const MPTNode& child) noexcept  // NOLINT(misc-no-recursion)
+bool MPTNode::erase(MPTNodeArena& arena, const Path& path)  // NOLINT(misc-no-recursion)
 {
-    if (auto e = child.encode(); e.size() < 32)
-        return e;  // "short" node
-    else
-        return rlp::encode(keccak256(e));
+    // The erasure is the insertion reversed: a branch node left with a single child
+    // is merged with the child (and with the extended node above, if any).
+
+    m_ref.clear();
+    switch (m_kind)
+    {
+    case Kind::branch:
+    {
+        auto& child = m_children[path.nibbles[0]];
+        if (child == nullptr)
+            return false;
+        if (child->erase(arena, path.tail(1)))
+        {
+            arena.destroy(child);
+            child = nullptr;
+        }
+
+        size_t num_left = 0;
+        size_t last_idx = 0;
+        for (size_t i = 0; i < num_children; ++i)
+        {
+            if (m_children[i] != nullptr)
+            {
+                ++num_left;
+                last_idx = i;
+            }
+        }
+        assert(num_left != 0);  // A branch had at least two children.
+        if (num_left == 1)
+        {
+            *this = merge(
+                arena, Path::nibble(static_cast<uint8_t>(last_idx)), m_children[last_idx]);
+        }
+        return false;
+    }
+
+    case Kind::ext:
+    {
+        if (path.length <= m_path.length || mismatch(m_path, path) != m_path.length)
+            return false;
+
+        [[maybe_unused]] const auto removed =
+            m_children[0]->erase(arena, path.tail(m_path.length));
+        assert(!removed);  // The child branch node cannot become empty.
+        if (m_children[0]->m_kind != Kind::branch)  // The child branch node has been merged.
+            *this = merge(arena, m_path, m_children[0]);
+        return false;
+    }
+
+    case Kind::leaf:
+        return m_path == path;
+
+    default:
+        assert(false);
+        return false;
+    }
 }
 
-bytes MPTNode::encode() const  // NOLINT(misc-no-recursion)
+void MPTNode::encode(bytes& out) const
 {
-    bytes encoded;
+    uint8_t path_buf[Path::max_encoded_size];
     switch (m_kind)
     {
     case Kind::leaf:
     {
-        encoded = rlp::encode(m_path.encode(false)) + rlp::encode(m_value);
+        rlp::append(out, std::tuple{m_path.encode(path_buf, false), bytes_view{m_value}});
         break;
     }
     case Kind::branch:
@@ -244,43 +494,181 @@ bytes MPTNode::encode() const  // NOLINT(misc-no-recursion)
         assert(m_path.length == 0);
         static constexpr uint8_t empty = 0x80;  // encoded empty child
 
-        for (const auto& child : m_children)
+        size_t content_size = 1;  // end indicator
+        for (const auto* child : m_children)
+            content_size += (child != nullptr) ? child->m_ref.view().size() : 1;
+
+        rlp::append_list_header(out, content_size);
+        for (const auto* child : m_children)
         {
-            if (child)
-                encoded += encode_child(*child);
+            assert(child == nullptr || !child->m_ref.empty());
+            if (child != nullptr)
+                out += child->m_ref.view();
             else
-                encoded += empty;
+                out += empty;
         }
-        encoded += empty;  // end indicator
+        out += empty;  // end indicator
         break;
     }
     case Kind::ext:
     {
-        encoded = rlp::encode(m_path.encode(true)) + encode_child(*m_children[0]);
+        assert(!m_children[0]->m_ref.empty());
+        rlp::append(
+            out, std::tuple{m_path.encode(path_buf, true), rlp::Raw{m_children[0]->m_ref.view()}});
         break;
     }
     }
+}
 
-    return rlp::internal::wrap_list(encoded);
+void MPTNode::compute_children_refs(bytes& buf) const  // NOLINT(misc-no-recursion)
+{
+    if (m_kind == Kind::ext)
+    {
+        (void)m_children[0]->ref(buf);
+        return;
+    }
+    if (m_kind != Kind::branch)
+        return;
+
+    // The encodings of the "long" children are kept one after another in the buffer
+    // for the batch hashing. The "short" ones are the references themselves.
+    const auto orig_size = buf.size();
+    size_t offsets[num_children + 1];
+    const MPTNode* hashed[num_children];
+    size_t num_hashed = 0;
+    for (const auto* child : m_children)
+    {
+        if (child == nullptr || !child->m_ref.empty())
+            continue;
+        child->compute_children_refs(buf);
+        const auto pos = buf.size();
+        child->encode(buf);
+        if (buf.size() - pos < 32)
+        {
+            child->m_ref.assign({&buf[pos], buf.size() - pos});  // "short" node
+            buf.resize(pos);
+        }
+        else
+        {
+            offsets[num_hashed] = pos;
+            hashed[num_hashed++] = child;
+        }
+    }
+    offsets[num_hashed] = buf.size();
+
+    // The views are taken once the buffer is not going to be reallocated.
+    bytes_view inputs[num_children];
+    for (size_t i = 0; i < num_hashed; ++i)
+        inputs[i] = {&buf[offsets[i]], offsets[i + 1] - offsets[i]};
+    hash256 hashes[num_children];
+    keccak256_batch({inputs, num_hashed}, {hashes, num_hashed});
+    for (size_t i = 0; i < num_hashed; ++i)
+        hashed[i]->m_ref.assign(hashes[i]);
+    buf.resize(orig_size);
+}
+
+bytes_view MPTNode::ref(bytes& buf) const  // NOLINT(misc-no-recursion)
+{
+    if (m_ref.empty())
+    {
+        compute_children_refs(buf);
+        const auto pos = buf.size();
+        encode(buf);
+        m_ref.assign({&buf[pos], buf.size() - pos});
+        buf.resize(pos);
+    }
+    return m_ref.view();
 }
 
 
+void MPTNode::compute_subtrie_refs(unsigned num_threads) const  // NOLINT(misc-no-recursion)
+{
+    if (!m_ref.empty())
+        return;
+    if (m_kind == Kind::ext)
+        return m_children[0]->compute_subtrie_refs(num_threads);
+    if (m_kind != Kind::branch)
+        return;
+
+    // Only the modified subtries need hashing.
+    std::vector<const MPTNode*> modified;
+    for (const auto* child : m_children)
+    {
+        if (child != nullptr && child->m_ref.empty())
+            modified.push_back(child);
+    }
+    parallel_for(modified.size(), num_threads, 1,
+        [&](size_t i) { (void)modified[i]->ref(encoding_buffer()); });
+}
+
 MPT::MPT() noexcept = default;
-MPT::~MPT() noexcept = default;
+
+MPT::MPT(MPT&& other) noexcept
+  : m_arena{std::move(other.m_arena)},
+    m_root{std::exchange(other.m_root, nullptr)},
+    m_num_modified{std::exchange(other.m_num_modified, 0)}
+{}
+
+MPT& MPT::operator=(MPT&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (m_root != nullptr)
+            MPTNode::destroy(*m_arena, m_root);
+        m_arena = std::move(other.m_arena);
+        m_root = std::exchange(other.m_root, nullptr);
+        m_num_modified = std::exchange(other.m_num_modified, 0);
+    }
+    return *this;
+}
+
+MPT::~MPT() noexcept
+{
+    if (m_root != nullptr)
+        MPTNode::destroy(*m_arena, m_root);
+}
 
 void MPT::insert(bytes_view key, bytes&& value)
 {
+    if (m_arena == nullptr)
+        m_arena = std::make_unique<MPTNodeArena>();
+
     if (m_root == nullptr)
-        m_root = MPTNode::leaf(Path{key}, std::move(value));
+        m_root = MPTNode::leaf(*m_arena, Path{key}, std::move(value));
     else
-        m_root->insert(Path{key}, std::move(value));
+        m_root->insert(*m_arena, Path{key}, std::move(value));
+    ++m_num_modified;
+}
+
+void MPT::erase(bytes_view key)
+{
+    ++m_num_modified;
+    if (m_root != nullptr && m_root->erase(*m_arena, Path{key}))
+    {
+        m_arena->destroy(m_root);
+        m_root = nullptr;
+    }
 }
 
-[[nodiscard]] hash256 MPT::hash() const
+[[nodiscard]] hash256 MPT::hash(unsigned num_threads) const
 {
+    // E.g. the root hash after every transaction modifies a few leaves: hash them in place.
+    const auto num_used_threads =
+        std::min(size_t{num_threads}, std::exchange(m_num_modified, 0) / min_modified_per_thread);
     if (m_root == nullptr)
         return emptyMPTHash;
-    return keccak256(m_root->encode());
+
+    if (num_used_threads > 1)
+        m_root->compute_subtrie_refs(static_cast<unsigned>(num_used_threads));
+
+    // The root is hashed even if short. Otherwise, its reference is the RLP-encoded hash.
+    const auto ref = m_root->ref(encoding_buffer());
+    if (ref.size() < 32)
+        return keccak256(ref);
+    hash256 h;
+    assert(ref.size() == 1 + sizeof(h));
+    std::copy_n(&ref[1], sizeof(h), h.bytes);
+    return h;
 }
 
 }  // namespace evmone::state
@@ -11,19 +11,44 @@ namespace evmone::state
 constexpr auto emptyMPTHash =
     0x56e81f171bcc55a6ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421_bytes32;
 
-/// Insert-only Merkle Patricia Trie implementation for getting the root hash
-/// out of (key, value) pairs.
+/// Merkle Patricia Trie implementation for getting the root hash out of (key, value) pairs.
+///
+/// The trie is persistent: the values can be updated and erased, and the nodes memoize their
+/// hashes, so the root hash after a modification only rehashes the nodes on the modified paths.
+/// The keys must be prefix-free (e.g. of the same length, or RLP-encoded).
+///
+/// The nodes are allocated in an arena owned by the trie.
 class MPT
 {
-    std::unique_ptr<class MPTNode> m_root;
+    /// The storage of the nodes, created on the first insertion.
+    std::unique_ptr<class MPTNodeArena> m_arena;
+
+    class MPTNode* m_root = nullptr;
+
+    /// The number of the insertions and erasures since the last hash():
+    /// the estimate of the leaves to rehash.
+    mutable size_t m_num_modified = 0;
 
 public:
+    /// The minimum number of the modified leaves to rehash by a thread:
+    /// a thread costs more than hashing a few paths.
+    static constexpr size_t min_modified_per_thread = 64;
+
     MPT() noexcept;
+    MPT(MPT&&) noexcept;
+    MPT& operator=(MPT&&) noexcept;
     ~MPT() noexcept;
 
+    /// Inserts the value at the key, or replaces the value already there.
     void insert(bytes_view key, bytes&& value);
 
-    [[nodiscard]] hash256 hash() const;
+    /// Erases the value at the key, if present.
+    void erase(bytes_view key);
+
+    /// Returns the root hash. With num_threads > 1, the subtries of the root branch
+    /// (by the first nibble of the keys) are hashed in parallel, on at most one thread
+    /// per min_modified_per_thread leaves modified since the last hash().
+    [[nodiscard]] hash256 hash(unsigned num_threads = 1) const;
 };
 
 }  // namespace evmone::state
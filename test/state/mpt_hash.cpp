@@ -5,6 +5,7 @@
 #include "mpt_hash.hpp"
 #include "account.hpp"
 #include "mpt.hpp"
+#include "parallel.hpp"
 #include "rlp.hpp"
 #include "state.hpp"
 
@@ -14,25 +15,55 @@ namespace
 {
 hash256 mpt_hash(const std::unordered_map<hash256, StorageValue>& storage)
 {
-    MPT trie;
+    std::vector<bytes_view> keys;
+    std::vector<bytes> values;
     for (const auto& [key, value] : storage)
     {
         if (!is_zero(value.current))  // Skip "deleted" values.
-            trie.insert(keccak256(key), rlp::encode(rlp::trim(value.current)));
+        {
+            keys.emplace_back(key);
+            values.emplace_back(rlp::encode(rlp::trim(value.current)));
+        }
     }
+    std::vector<hash256> hashed_keys(keys.size());
+    keccak256_batch(keys, hashed_keys);
+
+    MPT trie;
+    for (size_t i = 0; i < keys.size(); ++i)
+        trie.insert(hashed_keys[i], std::move(values[i]));
     return trie.hash();
 }
 }  // namespace
 
-hash256 mpt_hash(const std::unordered_map<address, Account>& accounts)
+hash256 mpt_hash(const std::unordered_map<address, Account>& accounts, unsigned num_threads)
 {
-    MPT trie;
+    // The minimum number of accounts to hash by a thread.
+    static constexpr size_t min_accounts_per_thread = 64;
+
+    // The keys and the values of the state trie, hashing the storage tries.
+    std::vector<const Account*> accs;
+    std::vector<bytes_view> addrs;
+    accs.reserve(accounts.size());
+    addrs.reserve(accounts.size());
     for (const auto& [addr, acc] : accounts)
     {
-        trie.insert(keccak256(addr),
-            rlp::encode_tuple(acc.nonce, acc.balance, mpt_hash(acc.storage), keccak256(acc.code)));
+        accs.push_back(&acc);
+        addrs.emplace_back(addr);
     }
-    return trie.hash();
+    std::vector<hash256> keys(accounts.size());
+    keccak256_batch(addrs, keys);
+
+    std::vector<bytes> values(accounts.size());
+    parallel_for(values.size(), num_threads, min_accounts_per_thread, [&](size_t i) {
+        const auto& acc = *accs[i];
+        values[i] =
+            rlp::encode_tuple(acc.nonce, acc.balance, mpt_hash(acc.storage), acc.code.hash());
+    });
+
+    MPT trie;
+    for (size_t i = 0; i < keys.size(); ++i)
+        trie.insert(keys[i], std::move(values[i]));
+    return trie.hash(num_threads);
 }
 
 template <typename T>
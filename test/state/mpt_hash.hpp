@@ -12,7 +12,9 @@ namespace evmone::state
 struct Account;
 
 /// Computes Merkle Patricia Trie root hash for the given collection of state accounts.
-hash256 mpt_hash(const std::unordered_map<address, Account>& accounts);
+/// With num_threads > 1, the storage tries and the subtries of the state trie are hashed
+/// in parallel.
+hash256 mpt_hash(const std::unordered_map<address, Account>& accounts, unsigned num_threads = 1);
 
 /// Computes Merkle Patricia Trie root hash for the given list of structures.
 template <typename T>
@@ -0,0 +1,36 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2023 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace evmone::state
+{
+/// Calls fn(i) for every i in [0, n) on up to num_threads threads, the calling one included.
+///
+/// The threads take the next index from a shared counter, so the items of uneven cost
+/// (e.g. the storage tries of different sizes) are balanced between the threads.
+/// A thread is only started for every grain items.
+template <typename Fn>
+void parallel_for(size_t n, unsigned num_threads, size_t grain, const Fn& fn)
+{
+    std::atomic<size_t> next = 0;
+    const auto work = [&] {
+        for (auto i = next.fetch_add(1, std::memory_order_relaxed); i < n;
+             i = next.fetch_add(1, std::memory_order_relaxed))
+            fn(i);
+    };
+
+    const auto num_used_threads = std::min(size_t{num_threads}, n / std::max(grain, size_t{1}));
+    std::vector<std::thread> threads;
+    for (size_t t = 1; t < num_used_threads; ++t)
+        threads.emplace_back(work);
+    work();
+    for (auto& thread : threads)
+        thread.join();
+}
+}  // namespace evmone::state
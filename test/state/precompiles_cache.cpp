@@ -9,40 +9,354 @@
 
 #include "precompiles_cache.hpp"
 #include <nlohmann/json.hpp>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <process.h>
+#endif
+
 namespace evmone::state
 {
-std::optional<evmc::Result> Cache::find(PrecompileId id, bytes_view input, int64_t gas_left) const
+namespace
+{
+/// The header of the binary cache file, followed by `count` records.
+struct FileHeader
+{
+    /// "EVMPCC02" in little-endian. Bump it when the file layout changes.
+    static constexpr uint64_t current_magic = 0x32304343504d5645;
+
+    uint64_t magic;
+    uint64_t count;
+    uint64_t checksum;  ///< The Checksum of the records.
+};
+
+/// The record of a cache entry in the binary cache file, followed by the output bytes.
+struct FileRecord
 {
-    if (const auto& cache = m_cache.at(stdx::to_underlying(id)); !cache.empty())
+    uint8_t id;
+    uint8_t success;
+    uint8_t reserved[2];
+    uint32_t output_size;
+    uint8_t input_hash[32];
+};
+
+/// The FNV-1a hash of the records of the cache file, checked by Cache::load()
+/// to reject a file corrupted after it has been written.
+class Checksum
+{
+    uint64_t m_value = 0xcbf29ce484222325;
+
+public:
+    void update(bytes_view data) noexcept
     {
-        const auto input_hash = keccak256(input);
-        if (const auto it = cache.find(input_hash); it != cache.end())
+        for (const auto b : data)
+            m_value = (m_value ^ b) * 0x100000001b3;
+    }
+
+    [[nodiscard]] uint64_t value() const noexcept { return m_value; }
+};
+
+/// Returns the path of a new temporary file next to the cache file.
+///
+/// The process id and the counter give every save() its own file,
+/// also the concurrent ones of other threads and processes saving to the same path.
+std::string temp_path(const std::string& path)
+{
+    static std::atomic<uint64_t> counter{0};
+#if defined(__unix__) || defined(__APPLE__)
+    const auto pid = ::getpid();
+#elif defined(_WIN32)
+    const auto pid = ::_getpid();
+#else
+    const auto pid = 0;
+#endif
+    return path + '.' + std::to_string(pid) + '.' +
+           std::to_string(counter.fetch_add(1, std::memory_order_relaxed)) + ".tmp";
+}
+
+/// The size of an entry accounted against the size budget: the output
+/// and the approximate memory overhead of the entry.
+size_t entry_size(bytes_view output) noexcept
+{
+    static constexpr size_t entry_overhead = 128;
+    return entry_overhead + output.size();
+}
+}  // namespace
+
+/// The read-only contents of a file, memory-mapped where supported.
+class MappedFile
+{
+    bytes_view m_data;
+#if defined(__unix__) || defined(__APPLE__)
+    void* m_addr = nullptr;
+#else
+    bytes m_buffer;
+#endif
+
+public:
+    /// Maps the file. The data is empty if the file cannot be read.
+    explicit MappedFile(const std::string& path) noexcept
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        const auto fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return;
+        struct stat st
+        {};
+        if (::fstat(fd, &st) == 0 && st.st_size > 0)
+        {
+            const auto size = static_cast<size_t>(st.st_size);
+            if (auto* const addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+                addr != MAP_FAILED)
+            {
+                m_addr = addr;
+                m_data = {static_cast<const uint8_t*>(addr), size};
+            }
+        }
+        ::close(fd);
+#else
+        try
         {
-            if (const auto& o = it->second; !o.has_value())
-                return evmc::Result{EVMC_PRECOMPILE_FAILURE};
-            else
-                return evmc::Result{EVMC_SUCCESS, gas_left, 0, o->data(), o->size()};
+            std::ifstream in{path, std::ios::binary};
+            m_buffer.assign(std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{});
+            m_data = m_buffer;
         }
+        catch (...)
+        {
+            m_data = {};
+        }
+#endif
     }
-    return {};
+
+    ~MappedFile() noexcept
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        if (m_addr != nullptr)
+            ::munmap(m_addr, m_data.size());
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    [[nodiscard]] bytes_view data() const noexcept { return m_data; }
+};
+
+void Cache::insert(PrecompileId id, const hash256& input_hash, bool success, bytes_view output,
+    bool mapped, bool pinned)
+{
+    auto& s = shard(input_hash);
+    const std::lock_guard lock{s.mutex};
+    const auto [it, inserted] = s.entries.at(stdx::to_underlying(id)).try_emplace(input_hash);
+    if (!inserted)
+        return;
+
+    auto& e = it->second;
+    e.success = success;
+    e.pinned = pinned;
+    e.mapped = mapped;
+    if (mapped)
+        e.mapped_output = output;
+    else
+        e.owned_output = output;
+    if (pinned)
+        return;
+
+    e.lru_pos = s.lru.emplace(s.lru.begin(), id, input_hash);
+    s.size += entry_size(output);
+    while (s.size > m_max_shard_size && s.lru.size() > 1)
+    {
+        const auto [evicted_id, evicted_hash] = s.lru.back();
+        auto& entries = s.entries[stdx::to_underlying(evicted_id)];
+        const auto evicted = entries.find(evicted_hash);
+        s.size -= entry_size(evicted->second.output());
+        entries.erase(evicted);
+        s.lru.pop_back();
+    }
+}
+
+std::optional<evmc::Result> Cache::find(PrecompileId id, bytes_view input, int64_t gas_left) const
+{
+    const auto input_hash = keccak256(input);
+    auto& s = shard(input_hash);
+    const std::lock_guard lock{s.mutex};
+    auto& entries = s.entries.at(stdx::to_underlying(id));
+    const auto it = entries.find(input_hash);
+    if (it == entries.end())
+        return {};
+
+    const auto& e = it->second;
+    if (!e.pinned)
+        s.lru.splice(s.lru.begin(), s.lru, e.lru_pos);  // Mark as the most recently used.
+    if (!e.success)
+        return evmc::Result{EVMC_PRECOMPILE_FAILURE};
+    const auto output = e.output();
+    return evmc::Result{EVMC_SUCCESS, gas_left, 0, output.data(), output.size()};
 }
 
 void Cache::insert(PrecompileId id, bytes_view input, const evmc::Result& result)
 {
     if (id == PrecompileId::identity)  // Do not cache "identity".
         return;
-    const auto input_hash = keccak256(input);
-    std::optional<bytes> cached_output;
-    if (result.status_code == EVMC_SUCCESS)
-        cached_output = bytes{result.output_data, result.output_size};
-    m_cache.at(stdx::to_underlying(id)).insert({input_hash, std::move(cached_output)});
+    const auto success = result.status_code == EVMC_SUCCESS;
+    insert(id, keccak256(input), success,
+        success ? bytes_view{result.output_data, result.output_size} : bytes_view{}, false, false);
+}
+
+size_t Cache::size() const
+{
+    size_t n = 0;
+    for (size_t i = 0; i < num_shards; ++i)
+    {
+        auto& s = m_shards[i];
+        const std::lock_guard lock{s.mutex};
+        for (const auto& entries : s.entries)
+            n += entries.size();
+    }
+    return n;
+}
+
+bool Cache::load(const std::string& path)
+{
+    auto file = std::make_unique<MappedFile>(path);
+    auto data = file->data();
+
+    FileHeader header{};
+    if (data.size() < sizeof(header))
+        return false;
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (header.magic != FileHeader::current_magic)
+        return false;
+    data.remove_prefix(sizeof(header));
+
+    // Validate the whole file first: a truncated or corrupted file is not loaded at all.
+    auto records = data;
+    for (uint64_t i = 0; i < header.count; ++i)
+    {
+        FileRecord record{};
+        if (records.size() < sizeof(record))
+            return false;
+        std::memcpy(&record, records.data(), sizeof(record));
+        records.remove_prefix(sizeof(record));
+        if (record.id >= NumPrecompiles || records.size() < record.output_size)
+            return false;
+        records.remove_prefix(record.output_size);
+    }
+    Checksum checksum;
+    checksum.update(data.substr(0, data.size() - records.size()));
+    if (checksum.value() != header.checksum)
+        return false;
+
+    for (uint64_t i = 0; i < header.count; ++i)
+    {
+        FileRecord record{};
+        std::memcpy(&record, data.data(), sizeof(record));
+        data.remove_prefix(sizeof(record));
+
+        hash256 input_hash;
+        std::memcpy(input_hash.bytes, record.input_hash, sizeof(input_hash));
+        insert(static_cast<PrecompileId>(record.id), input_hash, record.success != 0,
+            data.substr(0, record.output_size), true, false);
+        data.remove_prefix(record.output_size);
+    }
+
+    // The loaded entries point into the file: keep it mapped.
+    m_files.emplace_back(std::move(file));
+    return true;
+}
+
+bool Cache::save(const std::string& path) const
+{
+    // The file is written next to the destination and then renamed,
+    // so a cache file currently mapped (e.g. the one loaded from) stays intact.
+    const auto tmp_path = temp_path(path);
+    std::error_code ec;
+    {
+        std::ofstream out{tmp_path, std::ios::binary | std::ios::trunc};
+        if (!out)
+            return false;
+
+        // The header is written last, with the final count and checksum
+        // (the entries may have been inserted concurrently).
+        FileHeader header{FileHeader::current_magic, 0, 0};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        Checksum checksum;
+        const auto write = [&out, &checksum](bytes_view data) {
+            checksum.update(data);
+            out.write(reinterpret_cast<const char*>(data.data()),
+                static_cast<std::streamsize>(data.size()));
+        };
+        for (size_t i = 0; i < num_shards; ++i)
+        {
+            auto& s = m_shards[i];
+            const std::lock_guard lock{s.mutex};
+            for (size_t id = 0; id < std::size(s.entries); ++id)
+            {
+                for (const auto& [input_hash, e] : s.entries[id])
+                {
+                    const auto output = e.output();
+                    FileRecord record{};
+                    record.id = static_cast<uint8_t>(id);
+                    record.success = e.success;
+                    record.output_size = static_cast<uint32_t>(output.size());
+                    std::memcpy(record.input_hash, input_hash.bytes, sizeof(record.input_hash));
+                    write({reinterpret_cast<const uint8_t*>(&record), sizeof(record)});
+                    write(output);
+                    ++header.count;
+                }
+            }
+        }
+
+        header.checksum = checksum.value();
+        out.seekp(0);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        if (!out)
+        {
+            out.close();
+            std::filesystem::remove(tmp_path, ec);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tmp_path, path, ec);
+    if (ec)
+    {
+        std::error_code remove_ec;
+        std::filesystem::remove(tmp_path, remove_ec);
+        return false;
+    }
+    return true;
 }
 
-Cache::Cache() noexcept
+Cache::Cache(size_t max_size) noexcept
+  : m_shards{std::make_unique<Shard[]>(num_shards)}, m_max_shard_size{max_size / num_shards}
+{}
+
+Cache::Cache() noexcept : Cache{default_max_size}
 {
+    if (const auto cache_file = std::getenv("EVMONE_PRECOMPILES_CACHE"); cache_file != nullptr)
+    {
+        try
+        {
+            m_save_path = cache_file;
+            load(cache_file);  // The missing file is created at destruction.
+        }
+        catch (...)
+        {
+            std::cerr << "evmone: Loading precompiles cache from '" << cache_file
+                      << "' has failed!\n";
+        }
+    }
+
     const auto stub_file = std::getenv("EVMONE_PRECOMPILES_STUB");
     if (stub_file == nullptr)
         return;
@@ -52,12 +366,14 @@ Cache::Cache() noexcept
         const auto j = nlohmann::json::parse(std::ifstream{stub_file});
         for (size_t id = 0; id < j.size(); ++id)
         {
-            auto& cache = m_cache.at(id);
             for (const auto& [h_str, j_input] : j[id].items())
             {
-                auto& e = cache[evmc::from_hex<hash256>(h_str).value()];
+                const auto input_hash = evmc::from_hex<hash256>(h_str).value();
+                std::optional<bytes> output;
                 if (!j_input.is_null())
-                    e = evmc::from_hex(j_input.get<std::string>());
+                    output = evmc::from_hex(j_input.get<std::string>());
+                insert(static_cast<PrecompileId>(id), input_hash, output.has_value(),
+                    output.value_or(bytes{}), false, true);
             }
         }
     }
@@ -69,6 +385,20 @@ Cache::Cache() noexcept
 
 Cache::~Cache() noexcept
 {
+    if (!m_save_path.empty())
+    {
+        try
+        {
+            if (!save(m_save_path))
+                throw std::runtime_error{"cannot write the file"};
+        }
+        catch (...)
+        {
+            std::cerr << "evmone: Saving precompiles cache to '" << m_save_path
+                      << "' has failed!\n";
+        }
+    }
+
     const auto dump_file = std::getenv("EVMONE_PRECOMPILES_DUMP");
     if (dump_file == nullptr)
         return;
@@ -76,14 +406,17 @@ Cache::~Cache() noexcept
     try
     {
         nlohmann::json j;
-        for (size_t id = 0; id < std::size(m_cache); ++id)
+        for (size_t id = 0; id < NumPrecompiles; ++id)
         {
             auto& q = j[id];
-            for (const auto& [h, o] : m_cache[id])
+            for (size_t i = 0; i < num_shards; ++i)
             {
-                auto& v = q[evmc::hex(h)];
-                if (o)
-                    v = evmc::hex(*o);
+                for (const auto& [h, e] : m_shards[i].entries[id])
+                {
+                    auto& v = q[evmc::hex(h)];
+                    if (e.success)
+                        v = evmc::hex(e.output());
+                }
             }
         }
         std::ofstream{dump_file} << std::setw(2) << j << '\n';
@@ -2,27 +2,109 @@
 // Copyright 2022 The evmone Authors.
 // SPDX-License-Identifier: Apache-2.0
 
+#pragma once
+
 #include "hash_utils.hpp"
 #include "precompiles.hpp"
 #include <evmc/evmc.hpp>
 #include <array>
 #include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace evmone::state
 {
 using evmc::bytes;
 using evmc::bytes_view;
 
+/// The cache of the precompiles execution results, keyed by the precompile ID
+/// and the hash of the input.
+///
+/// The cache is thread-safe. It is split into shards by the input hash, each having its own lock,
+/// so the threads executing different inputs rarely wait for each other. The cached outputs are
+/// limited by the size budget: when a shard exceeds its part of the budget, its least recently
+/// used entries are evicted. The entries loaded from the precompiles stub are never evicted.
+///
+/// The entries can be saved to a binary cache file and loaded back from it.
+/// The loaded outputs stay in the memory-mapped file instead of being copied.
 class Cache
 {
-    std::array<std::unordered_map<hash256, std::optional<bytes>>, NumPrecompiles> m_cache;
+public:
+    /// The default size budget of the cache, in bytes: the total size of the outputs
+    /// and the entries overhead.
+    static constexpr size_t default_max_size = size_t{64} * 1024 * 1024;
+
+private:
+    static constexpr size_t num_shards = 16;
+
+    /// The key of the shard's LRU list.
+    using LruKey = std::pair<PrecompileId, hash256>;
+
+    struct Entry
+    {
+        bool success = false;
+        bool pinned = false;       ///< Loaded from the stub: not evicted.
+        bytes owned_output;        ///< The output, unless in a mapped cache file.
+        bytes_view mapped_output;  ///< The output in a mapped cache file.
+        bool mapped = false;
+        std::list<LruKey>::iterator lru_pos;  ///< Valid if not pinned.
+
+        [[nodiscard]] bytes_view output() const noexcept
+        {
+            return mapped ? mapped_output : bytes_view{owned_output};
+        }
+    };
+
+    struct Shard
+    {
+        std::mutex mutex;
+        std::array<std::unordered_map<hash256, Entry>, NumPrecompiles> entries;
+        std::list<LruKey> lru;  ///< The evictable entries, the most recently used first.
+        size_t size = 0;        ///< The size of the evictable entries.
+    };
+
+    std::unique_ptr<Shard[]> m_shards;
+
+    /// The size budget of a shard.
+    size_t m_max_shard_size = 0;
+
+    /// The memory-mapped cache files the entries have been loaded from.
+    std::vector<std::unique_ptr<class MappedFile>> m_files;
+
+    /// The cache file to save the entries to at destruction, if not empty.
+    std::string m_save_path;
+
+    [[nodiscard]] Shard& shard(const hash256& input_hash) const noexcept
+    {
+        return m_shards[input_hash.bytes[sizeof(input_hash) - 1] % num_shards];
+    }
+
+    /// Inserts the entry unless already present. The output view must be valid
+    /// for the lifetime of the cache if mapped.
+    void insert(PrecompileId id, const hash256& input_hash, bool success, bytes_view output,
+        bool mapped, bool pinned);
 
 public:
+    /// Creates the cache configured by the environment variables:
+    /// - EVMONE_PRECOMPILES_STUB: the JSON stub file with the results to preload,
+    /// - EVMONE_PRECOMPILES_CACHE: the binary cache file to load from and save to at destruction,
+    /// - EVMONE_PRECOMPILES_DUMP: the JSON file to dump the results to at destruction.
     Cache() noexcept;
+
+    /// Creates the empty cache with the given size budget.
+    explicit Cache(size_t max_size) noexcept;
+
     ~Cache() noexcept;
 
+    Cache(const Cache&) = delete;
+    Cache& operator=(const Cache&) = delete;
+
     /// Lookups the precompiles cache.
     ///
     /// @param id        The precompile ID.
@@ -35,5 +117,17 @@ public:
 
     /// Inserts new precompiles cache entry.
     void insert(PrecompileId id, bytes_view input, const evmc::Result& result);
+
+    /// Returns the number of the cached entries.
+    [[nodiscard]] size_t size() const;
+
+    /// Loads the entries from the binary cache file, which stays memory-mapped.
+    /// Returns false if the file cannot be read or is invalid (e.g. truncated or corrupted).
+    bool load(const std::string& path);
+
+    /// Saves the entries to the binary cache file, replacing it at once:
+    /// the concurrent saves to the same file do not mix their entries.
+    /// Returns false if the file cannot be written.
+    bool save(const std::string& path) const;
 };
 }  // namespace evmone::state
@@ -5,118 +5,591 @@
 #pragma once
 
 #include <intx/intx.hpp>
+#include <bit>
 #include <cassert>
+#include <concepts>
+#include <span>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <utility>
 #include <vector>
 
+/// RLP encoding and decoding.
+///
+/// The encoding is done in two passes: the exact size of the encoding is computed first
+/// (encoded_size()) and then the encoding is written at once to the output (encode_to()),
+/// without building the encodings of the nested items. The first pass records the content
+/// sizes of the (nested) lists for the headers written by the second one.
+///
+/// The supported items are: byte strings (anything convertible to bytes_view), uint64_t,
+/// uint256, std::vector, C arrays, std::pair and std::tuple (as lists) and pre-encoded items (Raw).
+/// A custom type is supported by defining, in its namespace, one of the functions:
+/// - rlp_fields(const T&) returning the tuple of the fields to be encoded as RLP list
+///   (e.g. std::tie() of the members),
+/// - rlp_typed_fields(const T&, visit) calling visit(type, fields) with the EIP-2718 type byte
+///   (0 for none) and the tuple of the fields, for types encoded differently by their type
+///   (e.g. transactions), and returning its result,
+/// - rlp_encode(const T&) returning the encoding as bytes. This is the slowest: the encoding
+///   is built to get its size, and again to write it.
+///
+/// The decoding functions return views of the input buffer.
 namespace evmone::rlp
 {
 using bytes = std::basic_string<uint8_t>;
 using bytes_view = std::basic_string_view<uint8_t>;
 
+/// The already RLP-encoded item, copied to the output as is.
+struct Raw
+{
+    bytes_view encoding;
+};
+
+/// The type encoded as the RLP list of its fields.
+template <typename T>
+concept EncodedAsFields = requires(const T& v) { rlp_fields(v); };
+
+/// The type encoded as the RLP list of the fields of its type, in the EIP-2718 typed envelope
+/// if the type is not 0.
+template <typename T>
+concept EncodedAsTypedFields = requires(const T& v) {
+    rlp_typed_fields(v, [](uint8_t, const auto&) { return size_t{0}; });
+};
+
+/// The type having the custom encoding function.
+template <typename T>
+concept EncodedByFunction = requires(const T& v) {
+    {
+        rlp_encode(v)
+    } -> std::convertible_to<bytes>;
+};
+
 namespace internal
 {
+constexpr uint8_t string_short_base = 0x80;
+constexpr uint8_t string_long_base = 0xb7;
+constexpr uint8_t list_short_base = 0xc0;
+constexpr uint8_t list_long_base = 0xf7;
+constexpr size_t short_cutoff = 55;
+
+/// Returns the size of the RLP length prefix of an item of the given length.
+constexpr size_t length_prefix_size(size_t l) noexcept
+{
+    return l <= short_cutoff ? 1 : l <= 0xff ? 2 : l <= 0xffff ? 3 : 4;
+}
+
+/// Writes the RLP length prefix. Returns the end of the output.
 template <uint8_t ShortBase, uint8_t LongBase>
-inline bytes encode_length(size_t l)
+inline uint8_t* write_length(uint8_t* out, size_t l) noexcept
 {
-    static constexpr uint8_t short_cutoff = 55;
     static_assert(ShortBase + short_cutoff <= 0xff);
     assert(l <= 0xffffff);
 
-    if (l <= short_cutoff)
-        return {static_cast<uint8_t>(ShortBase + l)};
-    else if (const auto l0 = static_cast<uint8_t>(l); l <= 0xff)
-        return {LongBase + 1, l0};
-    else if (const auto l1 = static_cast<uint8_t>(l >> 8); l <= 0xffff)
-        return {LongBase + 2, l1, l0};
-    else
-        return {LongBase + 3, static_cast<uint8_t>(l >> 16), l1, l0};
+    const auto prefix_size = length_prefix_size(l);
+    if (prefix_size == 1)
+    {
+        *out++ = static_cast<uint8_t>(ShortBase + l);
+        return out;
+    }
+
+    *out++ = static_cast<uint8_t>(LongBase + prefix_size - 1);
+    for (auto i = prefix_size - 1; i != 0; --i)
+        *out++ = static_cast<uint8_t>(l >> (8 * (i - 1)));
+    return out;
 }
 
-inline bytes wrap_list(const bytes& content)
+/// The content sizes of the lists of an item, in the order of their headers in the encoding:
+/// recorded by encoded_size() and consumed by write(), so the size of each nested list
+/// is computed once.
+class ListSizes
+{
+    static constexpr size_t inline_capacity = 16;
+
+    size_t m_inline[inline_capacity]{};
+    std::vector<size_t> m_more;
+    size_t m_count = 0;
+    size_t m_next = 0;
+
+    size_t& at(size_t index) noexcept
+    {
+        return index < inline_capacity ? m_inline[index] : m_more[index - inline_capacity];
+    }
+
+public:
+    /// Reserves the entry of the next list, to be set once its content has been measured.
+    size_t reserve()
+    {
+        const auto index = m_count++;
+        if (index >= inline_capacity)
+            m_more.emplace_back();
+        return index;
+    }
+
+    void set(size_t index, size_t content_size) noexcept { at(index) = content_size; }
+
+    /// Returns the content size of the next list to be written.
+    size_t next() noexcept
+    {
+        assert(m_next < m_count);
+        return at(m_next++);
+    }
+};
+
+/// The sizes of the encodings. The templates are declared first so that they can be nested.
+/// @{
+inline size_t encoded_size(ListSizes& sizes, bytes_view data) noexcept;
+inline size_t encoded_size(ListSizes& sizes, uint64_t x) noexcept;
+inline size_t encoded_size(ListSizes& sizes, const intx::uint256& x) noexcept;
+inline size_t encoded_size(ListSizes& sizes, const Raw& raw) noexcept;
+template <typename T>
+inline size_t encoded_size(ListSizes& sizes, const std::vector<T>& v);
+template <typename T, size_t N>
+inline size_t encoded_size(ListSizes& sizes, const T (&v)[N]);
+template <typename T1, typename T2>
+inline size_t encoded_size(ListSizes& sizes, const std::pair<T1, T2>& p);
+template <typename... Types>
+inline size_t encoded_size(ListSizes& sizes, const std::tuple<Types...>& t);
+template <EncodedAsFields T>
+inline size_t encoded_size(ListSizes& sizes, const T& v);
+template <EncodedAsTypedFields T>
+inline size_t encoded_size(ListSizes& sizes, const T& v);
+template <EncodedByFunction T>
+inline size_t encoded_size(ListSizes& sizes, const T& v);
+/// @}
+
+/// The writers of the encodings. They return the end of the output.
+/// @{
+inline uint8_t* write(uint8_t* out, ListSizes& sizes, bytes_view data) noexcept;
+inline uint8_t* write(uint8_t* out, ListSizes& sizes, uint64_t x) noexcept;
+inline uint8_t* write(uint8_t* out, ListSizes& sizes, const intx::uint256& x) noexcept;
+inline uint8_t* write(uint8_t* out, ListSizes& sizes, const Raw& raw) noexcept;
+template <typename T>
+inline uint8_t* write(uint8_t* out, ListSizes& sizes, const std::vector<T>& v);
+template <typename T, size_t N>
+inline uint8_t* write(uint8_t* out, ListSizes& sizes, const T (&v)[N]);
+template <typename T1, typename T2>
+inline uint8_t* write(uint8_t* out, ListSizes& sizes, const std::pair<T1, T2>& p);
+template <typename... Types>
+inline uint8_t* write(uint8_t* out, ListSizes& sizes, const std::tuple<Types...>& t);
+template <EncodedAsFields T>
+inline uint8_t* write(uint8_t* out, ListSizes& sizes, const T& v);
+template <EncodedAsTypedFields T>
+inline uint8_t* write(uint8_t* out, ListSizes& sizes, const T& v);
+template <EncodedByFunction T>
+inline uint8_t* write(uint8_t* out, ListSizes& sizes, const T& v);
+/// @}
+
+/// The size of the RLP list with the content of the given size.
+inline size_t list_size(size_t content_size) noexcept
 {
-    return internal::encode_length<192, 247>(content.size()) + content;
+    return length_prefix_size(content_size) + content_size;
 }
 
+/// Returns the size of the RLP list of the items and records its content size.
 template <typename InputIterator>
-inline bytes encode_container(InputIterator begin, InputIterator end);
-}  // namespace internal
+inline size_t list_encoded_size(ListSizes& sizes, InputIterator begin, InputIterator end)
+{
+    const auto index = sizes.reserve();
+    size_t content_size = 0;
+    for (auto it = begin; it != end; ++it)
+        content_size += encoded_size(sizes, *it);
+    sizes.set(index, content_size);
+    return list_size(content_size);
+}
 
-inline bytes_view trim(bytes_view b) noexcept
+template <typename InputIterator>
+inline uint8_t* write_list(uint8_t* out, ListSizes& sizes, InputIterator begin, InputIterator end)
+{
+    out = write_length<list_short_base, list_long_base>(out, sizes.next());
+    for (auto it = begin; it != end; ++it)
+        out = write(out, sizes, *it);
+    return out;
+}
+
+/// Returns the minimal big-endian bytes of the unsigned integer, stored in the buffer.
+template <typename UintT>
+inline bytes_view to_minimal_be(uint8_t (&buf)[sizeof(UintT)], const UintT& x) noexcept
 {
+    intx::be::store(buf, x);
+    bytes_view b{buf, sizeof(buf)};
     b.remove_prefix(std::min(b.find_first_not_of(uint8_t{0x00}), b.size()));
     return b;
 }
 
+inline size_t encoded_size(ListSizes& /*sizes*/, bytes_view data) noexcept
+{
+    if (data.size() == 1 && data[0] < string_short_base)
+        return 1;
+    return length_prefix_size(data.size()) + data.size();
+}
+
+inline size_t encoded_size(ListSizes& /*sizes*/, uint64_t x) noexcept
+{
+    if (x < string_short_base)
+        return 1;
+    return 1 + static_cast<size_t>(std::bit_width(x) + 7) / 8;
+}
+
+inline size_t encoded_size(ListSizes& sizes, const intx::uint256& x) noexcept
+{
+    uint8_t buf[sizeof(x)];
+    return encoded_size(sizes, to_minimal_be(buf, x));
+}
+
+inline size_t encoded_size(ListSizes& /*sizes*/, const Raw& raw) noexcept
+{
+    return raw.encoding.size();
+}
+
 template <typename T>
-inline decltype(rlp_encode(std::declval<T>())) encode(const T& v)
+inline size_t encoded_size(ListSizes& sizes, const std::vector<T>& v)
 {
-    return rlp_encode(v);
+    return list_encoded_size(sizes, v.begin(), v.end());
 }
 
-inline bytes encode(bytes_view data)
+template <typename T, size_t N>
+inline size_t encoded_size(ListSizes& sizes, const T (&v)[N])
+{
+    return list_encoded_size(sizes, std::begin(v), std::end(v));
+}
+
+template <typename T1, typename T2>
+inline size_t encoded_size(ListSizes& sizes, const std::pair<T1, T2>& p)
+{
+    const auto index = sizes.reserve();
+    const auto content_size = encoded_size(sizes, p.first) + encoded_size(sizes, p.second);
+    sizes.set(index, content_size);
+    return list_size(content_size);
+}
+
+template <typename... Types>
+inline size_t encoded_size(ListSizes& sizes, const std::tuple<Types...>& t)
 {
-    static constexpr uint8_t short_base = 128;
-    if (data.size() == 1 && data[0] < short_base)
-        return {data[0]};
+    const auto index = sizes.reserve();
+    // The fold of the comma operator measures the elements in order.
+    size_t content_size = 0;
+    std::apply([&](const auto&... e) { ((content_size += encoded_size(sizes, e)), ...); }, t);
+    sizes.set(index, content_size);
+    return list_size(content_size);
+}
 
-    return internal::encode_length<short_base, 183>(data.size()) += data;  // Op + not available.
+template <EncodedAsFields T>
+inline size_t encoded_size(ListSizes& sizes, const T& v)
+{
+    return encoded_size(sizes, rlp_fields(v));
+}
+
+template <EncodedAsTypedFields T>
+inline size_t encoded_size(ListSizes& sizes, const T& v)
+{
+    return rlp_typed_fields(v, [&sizes](uint8_t type, const auto& fields) {
+        return (type != 0 ? size_t{1} : size_t{0}) + encoded_size(sizes, fields);
+    });
+}
+
+template <EncodedByFunction T>
+inline size_t encoded_size(ListSizes& /*sizes*/, const T& v)
+{
+    return bytes{rlp_encode(v)}.size();
 }
 
-inline bytes encode(uint64_t x)
+inline uint8_t* write(uint8_t* out, ListSizes& /*sizes*/, bytes_view data) noexcept
 {
-    uint8_t b[sizeof(x)];
-    intx::be::store(b, x);
-    return encode(trim({b, sizeof(b)}));
+    if (data.size() == 1 && data[0] < string_short_base)
+    {
+        *out++ = data[0];
+        return out;
+    }
+    out = write_length<string_short_base, string_long_base>(out, data.size());
+    return std::copy(data.begin(), data.end(), out);
 }
 
-inline bytes encode(const intx::uint256& x)
+inline uint8_t* write(uint8_t* out, ListSizes& sizes, uint64_t x) noexcept
 {
-    uint8_t b[sizeof(x)];
-    intx::be::store(b, x);
-    return encode(trim({b, sizeof(b)}));
+    uint8_t buf[sizeof(x)];
+    return write(out, sizes, to_minimal_be(buf, x));
+}
+
+inline uint8_t* write(uint8_t* out, ListSizes& sizes, const intx::uint256& x) noexcept
+{
+    uint8_t buf[sizeof(x)];
+    return write(out, sizes, to_minimal_be(buf, x));
+}
+
+inline uint8_t* write(uint8_t* out, ListSizes& /*sizes*/, const Raw& raw) noexcept
+{
+    return std::copy(raw.encoding.begin(), raw.encoding.end(), out);
 }
 
 template <typename T>
-inline bytes encode(const std::vector<T>& v)
+inline uint8_t* write(uint8_t* out, ListSizes& sizes, const std::vector<T>& v)
 {
-    return internal::encode_container(v.begin(), v.end());
+    return write_list(out, sizes, v.begin(), v.end());
 }
 
 template <typename T, size_t N>
-inline bytes encode(const T (&v)[N])
+inline uint8_t* write(uint8_t* out, ListSizes& sizes, const T (&v)[N])
+{
+    return write_list(out, sizes, std::begin(v), std::end(v));
+}
+
+template <typename T1, typename T2>
+inline uint8_t* write(uint8_t* out, ListSizes& sizes, const std::pair<T1, T2>& p)
 {
-    return internal::encode_container(std::begin(v), std::end(v));
+    out = write_length<list_short_base, list_long_base>(out, sizes.next());
+    out = write(out, sizes, p.first);
+    return write(out, sizes, p.second);
+}
+
+template <typename... Types>
+inline uint8_t* write(uint8_t* out, ListSizes& sizes, const std::tuple<Types...>& t)
+{
+    out = write_length<list_short_base, list_long_base>(out, sizes.next());
+    std::apply([&](const auto&... e) { ((out = write(out, sizes, e)), ...); }, t);
+    return out;
+}
+
+template <EncodedAsFields T>
+inline uint8_t* write(uint8_t* out, ListSizes& sizes, const T& v)
+{
+    return write(out, sizes, rlp_fields(v));
+}
+
+template <EncodedAsTypedFields T>
+inline uint8_t* write(uint8_t* out, ListSizes& sizes, const T& v)
+{
+    return rlp_typed_fields(v, [out, &sizes](uint8_t type, const auto& fields) mutable {
+        if (type != 0)
+            *out++ = type;
+        return write(out, sizes, fields);
+    });
+}
+
+template <EncodedByFunction T>
+inline uint8_t* write(uint8_t* out, ListSizes& /*sizes*/, const T& v)
+{
+    const bytes encoding{rlp_encode(v)};
+    return std::copy(encoding.begin(), encoding.end(), out);
+}
+}  // namespace internal
+
+inline bytes_view trim(bytes_view b) noexcept
+{
+    b.remove_prefix(std::min(b.find_first_not_of(uint8_t{0x00}), b.size()));
+    return b;
+}
+
+/// Returns the size of the RLP encoding of the item.
+template <typename T>
+inline size_t encoded_size(const T& v)
+{
+    internal::ListSizes sizes;
+    return internal::encoded_size(sizes, v);
+}
+
+/// Writes the RLP encoding of the item to the output, which must fit it (see encoded_size()).
+/// Returns the size of the encoding.
+template <typename T>
+inline size_t encode_to(std::span<uint8_t> out, const T& v)
+{
+    internal::ListSizes sizes;
+    [[maybe_unused]] const auto size = internal::encoded_size(sizes, v);
+    assert(out.size() >= size);
+    return static_cast<size_t>(internal::write(out.data(), sizes, v) - out.data());
+}
+
+/// Appends the RLP encoding of the item to the output.
+template <typename T>
+inline void append(bytes& out, const T& v)
+{
+    internal::ListSizes sizes;
+    const auto pos = out.size();
+    out.resize(pos + internal::encoded_size(sizes, v));
+    internal::write(&out[pos], sizes, v);
+}
+
+/// Appends the header of the RLP list having the content of the given size.
+/// The content (the encoded list items) must be appended after it.
+inline void append_list_header(bytes& out, size_t content_size)
+{
+    uint8_t buf[4];
+    const auto end =
+        internal::write_length<internal::list_short_base, internal::list_long_base>(
+            buf, content_size);
+    out.append(buf, end);
+}
+
+/// Returns the RLP encoding of the item.
+template <typename T>
+inline bytes encode(const T& v)
+{
+    if constexpr (EncodedByFunction<T>)
+        return rlp_encode(v);
+    else
+    {
+        internal::ListSizes sizes;
+        bytes out(internal::encoded_size(sizes, v), 0);
+        internal::write(out.data(), sizes, v);
+        return out;
+    }
+}
+
+/// Returns the RLP encoding of the bytes.
+inline bytes encode(bytes_view data)
+{
+    return encode<bytes_view>(data);
 }
 
 /// Encodes the fixed-size collection of heterogeneous values as RLP list.
 template <typename... Types>
 inline bytes encode_tuple(const Types&... elements)
 {
-    return internal::wrap_list((encode(elements) + ...));
+    return encode(std::forward_as_tuple(elements...));
 }
 
-/// Encodes a pair of values as RPL list.
-template <typename T1, typename T2>
-inline bytes encode(const std::pair<T1, T2>& p)
+/// Encodes the EIP-2718 typed envelope: the type byte followed by the RLP list of the values.
+template <typename... Types>
+inline bytes encode_typed(uint8_t type, const Types&... elements)
 {
-    return encode_tuple(p.first, p.second);
+    const auto fields = std::forward_as_tuple(elements...);
+    internal::ListSizes sizes;
+    bytes out(1 + internal::encoded_size(sizes, fields), 0);
+    out[0] = type;
+    internal::write(&out[1], sizes, fields);
+    return out;
 }
 
-/// Encodes the container as RLP list.
-///
-/// @tparam InputIterator  Type of the input iterator.
-/// @param  begin          Begin iterator.
-/// @param  end            End iterator.
-/// @return                Bytes of the RLP list.
-template <typename InputIterator>
-inline bytes internal::encode_container(InputIterator begin, InputIterator end)
+
+/// The RLP item decoded from the input.
+struct Item
 {
-    bytes content;
-    for (auto it = begin; it != end; ++it)
-        content += encode(*it);
-    return wrap_list(content);
+    bool is_list = false;
+    bytes_view payload;  ///< The string bytes or the encoding of the list items.
+};
+
+/// Decodes the RLP item at the front of the input and removes it from the input.
+/// The payload is the view of the input.
+/// Throws std::invalid_argument if the encoding is malformed or non-canonical.
+inline Item decode_item(bytes_view& input)
+{
+    if (input.empty())
+        throw std::invalid_argument("rlp: unexpected end of input");
+
+    const auto prefix = input[0];
+    if (prefix < internal::string_short_base)  // Single byte.
+    {
+        const Item item{false, input.substr(0, 1)};
+        input.remove_prefix(1);
+        return item;
+    }
+
+    const auto is_list = prefix >= internal::list_short_base;
+    const auto short_base = is_list ? internal::list_short_base : internal::string_short_base;
+    const auto long_base = is_list ? internal::list_long_base : internal::string_long_base;
+
+    size_t header_size = 1;
+    size_t length = 0;
+    if (prefix <= long_base)
+        length = prefix - short_base;
+    else
+    {
+        const size_t length_size = prefix - long_base;
+        if (length_size > 4 || input.size() < 1 + length_size)
+            throw std::invalid_argument("rlp: invalid length");
+        if (input[1] == 0)
+            throw std::invalid_argument("rlp: non-canonical length");
+        for (size_t i = 0; i < length_size; ++i)
+            length = (length << 8) | input[1 + i];
+        if (length <= internal::short_cutoff)
+            throw std::invalid_argument("rlp: non-canonical length");
+        header_size += length_size;
+    }
+
+    if (input.size() - header_size < length)
+        throw std::invalid_argument("rlp: unexpected end of input");
+    const Item item{is_list, input.substr(header_size, length)};
+    if (!is_list && length == 1 && item.payload[0] < internal::string_short_base)
+        throw std::invalid_argument("rlp: non-canonical single byte");
+    input.remove_prefix(header_size + length);
+    return item;
+}
+
+/// Decodes the RLP string at the front of the input. Returns the view of the string bytes.
+inline bytes_view decode_string(bytes_view& input)
+{
+    const auto item = decode_item(input);
+    if (item.is_list)
+        throw std::invalid_argument("rlp: unexpected list");
+    return item.payload;
+}
+
+/// Decodes the RLP list at the front of the input. Returns the view of the encoded items,
+/// to be decoded one after another.
+inline bytes_view decode_list(bytes_view& input)
+{
+    const auto item = decode_item(input);
+    if (!item.is_list)
+        throw std::invalid_argument("rlp: unexpected string");
+    return item.payload;
+}
+
+inline void decode(bytes_view& input, bytes_view& out)
+{
+    out = decode_string(input);
+}
+
+inline void decode(bytes_view& input, bytes& out)
+{
+    out = decode_string(input);
+}
+
+/// Decodes the unsigned integer, without leading zero bytes.
+template <typename UintT>
+    requires std::same_as<UintT, uint64_t> || std::same_as<UintT, intx::uint256>
+inline void decode(bytes_view& input, UintT& out)
+{
+    const auto b = decode_string(input);
+    if (b.size() > sizeof(UintT))
+        throw std::invalid_argument("rlp: integer overflow");
+    if (!b.empty() && b[0] == 0)
+        throw std::invalid_argument("rlp: non-canonical integer");
+    uint8_t buf[sizeof(UintT)]{};
+    std::copy(b.begin(), b.end(), &buf[sizeof(buf) - b.size()]);
+    out = intx::be::load<UintT>(buf);
+}
+
+/// Decodes the fixed-size byte array (e.g. address or hash).
+template <typename T>
+    requires requires(T& v) {
+        {
+            v.bytes[0]
+        } -> std::same_as<uint8_t&>;
+    }
+inline void decode(bytes_view& input, T& out)
+{
+    const auto b = decode_string(input);
+    if (b.size() != sizeof(out.bytes))
+        throw std::invalid_argument("rlp: unexpected string size");
+    std::copy(b.begin(), b.end(), out.bytes);
+}
+
+template <typename T>
+inline void decode(bytes_view& input, std::vector<T>& out)
+{
+    auto items = decode_list(input);
+    out.clear();
+    while (!items.empty())
+        decode(items, out.emplace_back());
+}
+
+/// Decodes the RLP list of the heterogeneous values (see encode_tuple()).
+template <typename... Types>
+inline void decode_tuple(bytes_view& input, Types&... elements)
+{
+    auto items = decode_list(input);
+    (decode(items, elements), ...);
+    if (!items.empty())
+        throw std::invalid_argument("rlp: unexpected list items");
 }
 }  // namespace evmone::rlp
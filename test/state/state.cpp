@@ -6,12 +6,183 @@
 #include "../utils/stdx/utility.hpp"
 #include "errors.hpp"
 #include "host.hpp"
+#include "parallel.hpp"
 #include "rlp.hpp"
 #include <evmone/evmone.h>
 #include <evmone/execution_state.hpp>
 
 namespace evmone::state
 {
+void State::rollback(size_t checkpoint)
+{
+    assert(checkpoint <= m_journal.size());
+    while (m_journal.size() != checkpoint)
+    {
+        std::visit(
+            [this](auto& e) {
+                using T = std::decay_t<decltype(e)>;
+                if constexpr (std::is_same_v<T, JournalInsert>)
+                    m_accounts.erase(e.addr);
+                else if constexpr (std::is_same_v<T, JournalTouched>)
+                    get(e.addr).erasable = false;
+                else if constexpr (std::is_same_v<T, JournalBalanceChange>)
+                    get(e.addr).balance = e.prev_balance;
+                else if constexpr (std::is_same_v<T, JournalNonceChange>)
+                    get(e.addr).nonce = e.prev_nonce;
+                else if constexpr (std::is_same_v<T, JournalCodeChange>)
+                    get(e.addr).code = std::move(e.prev_code);
+                else if constexpr (std::is_same_v<T, JournalDestruct>)
+                    get(e.addr).destructed = false;
+                else if constexpr (std::is_same_v<T, JournalAccessAccount>)
+                    get(e.addr).access_status = EVMC_ACCESS_COLD;
+                else if constexpr (std::is_same_v<T, JournalStorageChange>)
+                {
+                    auto& storage = get(e.addr).storage;
+                    if (e.prev_value.has_value())
+                        storage[e.key] = *e.prev_value;
+                    else
+                        storage.erase(e.key);
+                }
+                else if constexpr (std::is_same_v<T, JournalTransientStorageChange>)
+                {
+                    auto& storage = get(e.addr).transient_storage;
+                    if (e.prev_value.has_value())
+                        storage[e.key] = *e.prev_value;
+                    else
+                        storage.erase(e.key);
+                }
+                else
+                    static_assert(std::is_void_v<T>, "unhandled journal entry type");
+            },
+            m_journal.back());
+        m_journal.pop_back();
+    }
+}
+
+void State::commit()
+{
+    if (m_tries.built)
+    {
+        for (const auto& entry : m_journal)
+        {
+            std::visit(
+                [this](const auto& e) {
+                    using T = std::decay_t<decltype(e)>;
+                    // The access statuses and the transient storage are not in the state root.
+                    if constexpr (std::is_same_v<T, JournalAccessAccount> ||
+                                  std::is_same_v<T, JournalTransientStorageChange>)
+                        return;
+                    else if constexpr (std::is_same_v<T, JournalStorageChange>)
+                        m_modified[e.addr].storage_keys.insert(e.key);
+                    else if constexpr (std::is_same_v<T, JournalInsert> ||
+                                       std::is_same_v<T, JournalDestruct>)
+                    {
+                        // The storage of a destructed or (re)created account is not the one of
+                        // its trie: rebuild it.
+                        m_modified[e.addr].inserted = true;
+                    }
+                    else
+                        m_modified.try_emplace(e.addr);
+                },
+                entry);
+        }
+    }
+    m_journal.clear();
+}
+
+hash256 State::root_hash(unsigned num_threads)
+{
+    // The minimum number of accounts to rehash by a thread.
+    static constexpr size_t min_accounts_per_thread = 64;
+
+    // The accounts to rehash, with their storage tries to update (or to rebuild if
+    // the modified storage keys are not known).
+    struct Update
+    {
+        const address& addr;
+        const Account& acc;
+        MPT& storage_trie;
+        const std::unordered_set<bytes32>* storage_keys;
+        bytes leaf;
+    };
+    std::vector<Update> updates;
+
+    if (!m_tries.built)
+    {
+        updates.reserve(m_accounts.size());
+        for (const auto& [addr, acc] : m_accounts)
+            updates.push_back({addr, acc, m_tries.storage[addr], nullptr, {}});
+        m_tries.built = true;
+    }
+    else
+    {
+        for (const auto& [addr, modification] : m_modified)
+        {
+            const auto it = m_accounts.find(addr);
+            if (it == m_accounts.end())
+            {
+                m_tries.accounts.erase(keccak256(addr));
+                m_tries.storage.erase(addr);
+                continue;
+            }
+            updates.push_back({addr, it->second, m_tries.storage[addr],
+                modification.inserted ? nullptr : &modification.storage_keys, {}});
+        }
+    }
+
+    // The accounts are independent: their storage tries are updated in parallel.
+    parallel_for(updates.size(), num_threads, min_accounts_per_thread, [&updates](size_t i) {
+        auto& update = updates[i];
+        const auto& acc = update.acc;
+        auto& storage_trie = update.storage_trie;
+
+        // The modified slots (all if the trie is rebuilt), the missing ones having null value.
+        std::vector<bytes_view> keys;
+        std::vector<const StorageValue*> values;
+        if (update.storage_keys == nullptr)
+        {
+            storage_trie = {};
+            for (const auto& [key, value] : acc.storage)
+            {
+                keys.emplace_back(key);
+                values.push_back(&value);
+            }
+        }
+        else
+        {
+            for (const auto& key : *update.storage_keys)
+            {
+                const auto slot = acc.storage.find(key);
+                keys.emplace_back(key);
+                values.push_back(slot != acc.storage.end() ? &slot->second : nullptr);
+            }
+        }
+        std::vector<hash256> hashed_keys(keys.size());
+        keccak256_batch(keys, hashed_keys);
+
+        for (size_t k = 0; k < keys.size(); ++k)
+        {
+            if (values[k] != nullptr && !is_zero(values[k]->current))
+                storage_trie.insert(hashed_keys[k], rlp::encode(rlp::trim(values[k]->current)));
+            else if (update.storage_keys != nullptr)  // Skip "deleted" values when rebuilding.
+                storage_trie.erase(hashed_keys[k]);
+        }
+        update.leaf =
+            rlp::encode_tuple(acc.nonce, acc.balance, storage_trie.hash(), acc.code.hash());
+    });
+
+    std::vector<bytes_view> addrs;
+    addrs.reserve(updates.size());
+    for (const auto& update : updates)
+        addrs.emplace_back(update.addr);
+    std::vector<hash256> keys(updates.size());
+    keccak256_batch(addrs, keys);
+    for (size_t i = 0; i < updates.size(); ++i)
+        m_tries.accounts.insert(keys[i], std::move(updates[i].leaf));
+    m_modified.clear();
+    return m_tries.accounts.hash(num_threads);
+}
+
 namespace
 {
 inline constexpr int64_t num_words(size_t size_in_bytes) noexcept
@@ -137,6 +308,14 @@ std::variant<int64_t, std::error_code> validate_transaction(const Account& sende
 
 namespace
 {
+/// Adds the value to the balance of the touched account (journaled).
+void add_balance(State& state, const address& addr, const intx::uint256& value)
+{
+    auto& acc = state.touch(addr);
+    state.journal_balance_change(addr, acc.balance);
+    acc.balance += value;
+}
+
 /// Deletes "touched" (marked as erasable) empty accounts in the state.
 void delete_empty_accounts(State& state)
 {
@@ -159,20 +338,22 @@ void finalize(State& state, evmc_revision rev, const address& coinbase,
         const auto reward_by_32 = reward / 32;
         const auto reward_by_8 = reward / 8;
 
-        state.touch(coinbase).balance += reward + reward_by_32 * ommers.size();
+        add_balance(state, coinbase, reward + reward_by_32 * ommers.size());
         for (const auto& ommer : ommers)
         {
             assert(ommer.delta > 0 && ommer.delta < 8);
-            state.touch(ommer.beneficiary).balance += reward_by_8 * (8 - ommer.delta);
+            add_balance(state, ommer.beneficiary, reward_by_8 * (8 - ommer.delta));
         }
     }
 
     for (const auto& withdrawal : withdrawals)
-        state.touch(withdrawal.recipient).balance += withdrawal.get_amount();
+        add_balance(state, withdrawal.recipient, withdrawal.get_amount());
 
     // Delete potentially empty block reward recipients.
     if (rev >= EVMC_SPURIOUS_DRAGON)
         delete_empty_accounts(state);
+
+    state.commit();
 }
 
 std::variant<TransactionReceipt, std::error_code> transition(State& state, const BlockInfo& block,
@@ -205,7 +386,9 @@ std::variant<TransactionReceipt, std::error_code> transition(State& state, const
     assert(effective_gas_price <= tx.max_gas_price);
     const auto tx_max_cost = tx.gas_limit * effective_gas_price;
 
-    sender_acc.balance -= tx_max_cost;  // Modify sender balance after all checks.
+    // Modify sender balance after all checks.
+    state.journal_balance_change(tx.sender, sender_acc.balance);
+    sender_acc.balance -= tx_max_cost;
 
     Host host{rev, vm, state, block, tx};
 
@@ -235,8 +418,10 @@ std::variant<TransactionReceipt, std::error_code> transition(State& state, const
     gas_used -= refund;
     assert(gas_used > 0);
 
-    state.get(tx.sender).balance += tx_max_cost - gas_used * effective_gas_price;
-    state.touch(block.coinbase).balance += gas_used * priority_gas_price;
+    auto& sender_balance = state.get(tx.sender).balance;
+    state.journal_balance_change(tx.sender, sender_balance);
+    sender_balance += tx_max_cost - gas_used * effective_gas_price;
+    add_balance(state, block.coinbase, gas_used * priority_gas_price);
 
     // Apply destructs.
     std::erase_if(state.get_accounts(),
@@ -266,75 +451,8 @@ std::variant<TransactionReceipt, std::error_code> transition(State& state, const
         }
     }
 
+    state.commit();
     return receipt;
 }
 
-[[nodiscard]] bytes rlp_encode(const Log& log)
-{
-    return rlp::encode_tuple(log.addr, log.topics, log.data);
-}
-
-[[nodiscard]] bytes rlp_encode(const Transaction& tx)
-{
-    if (tx.type == Transaction::Type::legacy)
-    {
-        // rlp [nonce, gas_price, gas_limit, to, value, data, v, r, s];
-        return rlp::encode_tuple(tx.nonce, tx.max_gas_price, static_cast<uint64_t>(tx.gas_limit),
-            tx.to.has_value() ? tx.to.value() : bytes_view(), tx.value, tx.data, tx.v, tx.r, tx.s);
-    }
-    else if (tx.type == Transaction::Type::access_list)
-    {
-        if (tx.v > 1)
-            throw std::invalid_argument("`v` value for eip2930 transaction must be 0 or 1");
-        // tx_type +
-        // rlp [nonce, gas_price, gas_limit, to, value, data, access_list, v, r, s];
-        return bytes{0x01} +  // Transaction type (eip2930 type == 1)
-               rlp::encode_tuple(tx.chain_id, tx.nonce, tx.max_gas_price,
-                   static_cast<uint64_t>(tx.gas_limit),
-                   tx.to.has_value() ? tx.to.value() : bytes_view(), tx.value, tx.data,
-                   tx.access_list, static_cast<bool>(tx.v), tx.r, tx.s);
-    }
-    else
-    {
-        if (tx.v > 1)
-            throw std::invalid_argument("`v` value for eip1559 transaction must be 0 or 1");
-        // tx_type +
-        // rlp [chain_id, nonce, max_priority_fee_per_gas, max_fee_per_gas, gas_limit, to, value,
-        // data, access_list, sig_parity, r, s];
-        return bytes{0x02} +  // Transaction type (eip1559 type == 2)
-               rlp::encode_tuple(tx.chain_id, tx.nonce, tx.max_priority_gas_price, tx.max_gas_price,
-                   static_cast<uint64_t>(tx.gas_limit),
-                   tx.to.has_value() ? tx.to.value() : bytes_view(), tx.value, tx.data,
-                   tx.access_list, static_cast<bool>(tx.v), tx.r, tx.s);
-    }
-}
-
-[[nodiscard]] bytes rlp_encode(const TransactionReceipt& receipt)
-{
-    if (receipt.post_state.has_value())
-    {
-        assert(receipt.type == Transaction::Type::legacy);
-
-        return rlp::encode_tuple(receipt.post_state.value(),
-            static_cast<uint64_t>(receipt.cumulative_gas_used),
-            bytes_view(receipt.logs_bloom_filter), receipt.logs);
-    }
-    else
-    {
-        const auto prefix = receipt.type == Transaction::Type::legacy ?
-                                bytes{} :
-                                bytes{stdx::to_underlying(receipt.type)};
-
-        return prefix + rlp::encode_tuple(receipt.status == EVMC_SUCCESS,
-                            static_cast<uint64_t>(receipt.cumulative_gas_used),
-                            bytes_view(receipt.logs_bloom_filter), receipt.logs);
-    }
-}
-
-[[nodiscard]] bytes rlp_encode(const Withdrawal& withdrawal)
-{
-    return rlp::encode_tuple(withdrawal.index, withdrawal.validator_index, withdrawal.recipient,
-        withdrawal.amount_in_gwei);
-}
-
 }  // namespace evmone::state
@@ -7,17 +7,116 @@
 #include "account.hpp"
 #include "bloom_filter.hpp"
 #include "hash_utils.hpp"
+#include "mpt.hpp"
 #include <cassert>
 #include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_set>
 #include <variant>
 #include <vector>
 
 namespace evmone::state
 {
+/// The journal entries: the previous values of the state modified by a transaction.
+/// @{
+struct JournalBase
+{
+    address addr;
+};
+
+/// The account has been inserted.
+struct JournalInsert : JournalBase
+{};
+
+/// The account has been touched (marked erasable).
+struct JournalTouched : JournalBase
+{};
+
+struct JournalBalanceChange : JournalBase
+{
+    intx::uint256 prev_balance;
+};
+
+struct JournalNonceChange : JournalBase
+{
+    uint64_t prev_nonce;
+};
+
+struct JournalCodeChange : JournalBase
+{
+    Code prev_code;
+};
+
+/// The account has been marked destructed.
+struct JournalDestruct : JournalBase
+{};
+
+/// The account has been accessed for the first time (EIP-2929).
+struct JournalAccessAccount : JournalBase
+{};
+
+struct JournalStorageChange : JournalBase
+{
+    bytes32 key;
+    std::optional<StorageValue> prev_value;  ///< None if the slot has been inserted.
+};
+
+struct JournalTransientStorageChange : JournalBase
+{
+    bytes32 key;
+    std::optional<bytes32> prev_value;  ///< None if the slot has been inserted.
+};
+
+using JournalEntry =
+    std::variant<JournalInsert, JournalTouched, JournalBalanceChange, JournalNonceChange,
+        JournalCodeChange, JournalDestruct, JournalAccessAccount, JournalStorageChange,
+        JournalTransientStorageChange>;
+/// @}
+
 class State
 {
     std::unordered_map<address, Account> m_accounts;
 
+    /// The changes since the last commit(), in order.
+    std::vector<JournalEntry> m_journal;
+
+    /// The changes of an account since the last root_hash().
+    struct Modification
+    {
+        /// The account has been (re)inserted: its storage trie must be rebuilt.
+        bool inserted = false;
+
+        /// The modified storage keys.
+        std::unordered_set<bytes32> storage_keys;
+    };
+
+    /// The tries of the state root hash, updated by root_hash().
+    ///
+    /// They are not copied with the state: a copy builds its tries on the first root_hash().
+    struct Tries
+    {
+        bool built = false;
+        MPT accounts;
+        std::unordered_map<address, MPT> storage;
+
+        Tries() = default;
+        Tries(const Tries&) noexcept {}
+        Tries(Tries&&) noexcept = default;
+        Tries& operator=(const Tries&) noexcept
+        {
+            *this = Tries{};
+            return *this;
+        }
+        Tries& operator=(Tries&&) noexcept = default;
+        ~Tries() = default;
+    };
+
+    /// The accounts modified since the last root_hash(). Only tracked once the tries are built.
+    std::unordered_map<address, Modification> m_modified;
+
+    Tries m_tries;
+
 public:
     /// Inserts the new account at the address.
     /// There must not exist any account under this address before.
@@ -25,6 +124,8 @@ public:
     {
         const auto r = m_accounts.insert({addr, std::move(account)});
         assert(r.second);
+        if (m_tries.built)
+            m_modified[addr].inserted = true;
         return r.first->second;
     }
 
@@ -45,22 +146,94 @@ public:
         return *acc;
     }
 
-    /// Gets an existing account or inserts new account.
+    /// Gets an existing account or inserts new account (journaled).
     Account& get_or_insert(const address& addr, Account account = {})
     {
         if (const auto acc = find(addr); acc != nullptr)
             return *acc;
+        m_journal.emplace_back(JournalInsert{{addr}});
         return insert(addr, std::move(account));
     }
 
-    /// Touches (as in EIP-161) an existing account or inserts new erasable account.
+    /// Touches (as in EIP-161) an existing account or inserts new erasable account (journaled).
     Account& touch(const address& addr)
     {
         auto& acc = get_or_insert(addr);
-        acc.erasable = true;
+        if (!acc.erasable)
+        {
+            m_journal.emplace_back(JournalTouched{{addr}});
+            acc.erasable = true;
+        }
         return acc;
     }
 
+    /// Returns the storage slot of the account, inserted if missing, for modification.
+    /// Its current value is journaled.
+    StorageValue& update_storage(const address& addr, const bytes32& key)
+    {
+        const auto [it, inserted] = get(addr).storage.try_emplace(key);
+        m_journal.emplace_back(JournalStorageChange{
+            {addr}, key, inserted ? std::nullopt : std::optional{it->second}});
+        return it->second;
+    }
+
+    /// Returns the transient storage slot of the account, inserted if missing, for modification.
+    /// Its current value is journaled.
+    bytes32& update_transient_storage(const address& addr, const bytes32& key)
+    {
+        const auto [it, inserted] = get(addr).transient_storage.try_emplace(key);
+        m_journal.emplace_back(JournalTransientStorageChange{
+            {addr}, key, inserted ? std::nullopt : std::optional{it->second}});
+        return it->second;
+    }
+
+    /// Journals the balance of the account before its modification.
+    void journal_balance_change(const address& addr, const intx::uint256& prev_balance)
+    {
+        m_journal.emplace_back(JournalBalanceChange{{addr}, prev_balance});
+    }
+
+    /// Journals the nonce of the account before its modification.
+    void journal_nonce_change(const address& addr, uint64_t prev_nonce)
+    {
+        m_journal.emplace_back(JournalNonceChange{{addr}, prev_nonce});
+    }
+
+    /// Journals the code of the account before its modification.
+    void journal_code_change(const address& addr, Code prev_code)
+    {
+        m_journal.emplace_back(JournalCodeChange{{addr}, std::move(prev_code)});
+    }
+
+    /// Journals the first destruction of the account.
+    void journal_destruct(const address& addr) { m_journal.emplace_back(JournalDestruct{{addr}}); }
+
+    /// Journals the first access to the account.
+    void journal_access_account(const address& addr)
+    {
+        m_journal.emplace_back(JournalAccessAccount{{addr}});
+    }
+
+    /// Returns the checkpoint to roll back to: the current position in the journal.
+    [[nodiscard]] size_t checkpoint() const noexcept { return m_journal.size(); }
+
+    /// Reverts the journaled changes made after the checkpoint, in the reverse order.
+    /// This costs as much as the changes, independently of the size of the state.
+    void rollback(size_t checkpoint);
+
+    /// Makes the changes final: clears the journal.
+    void commit();
+
+    /// Returns the state root hash: the Merkle Patricia Trie root hash of the accounts.
+    ///
+    /// The tries are kept between the calls and only the accounts modified since the last call
+    /// are rehashed, so the cost depends on the size of the changes rather than of the state.
+    /// The modifications are tracked by insert() and by the journal at commit(): the accounts
+    /// modified otherwise after the first call are not rehashed.
+    /// With num_threads > 1, the accounts, and the subtries of the state trie, are hashed
+    /// in parallel.
+    [[nodiscard]] hash256 root_hash(unsigned num_threads = 1);
+
     [[nodiscard]] auto& get_accounts() noexcept { return m_accounts; }
 
     [[nodiscard]] const auto& get_accounts() const noexcept { return m_accounts; }
@@ -190,16 +363,74 @@ std::variant<int64_t, std::error_code> validate_transaction(const Account& sende
     const BlockInfo& block, const Transaction& tx, evmc_revision rev,
     int64_t block_gas_left) noexcept;
 
-/// Defines how to RLP-encode a Transaction.
-[[nodiscard]] bytes rlp_encode(const Transaction& tx);
+/// Defines how to RLP-encode a Transaction: as the list of the fields of its type,
+/// in the EIP-2718 envelope for the typed transactions.
+template <typename Visitor>
+inline auto rlp_typed_fields(const Transaction& tx, Visitor&& visit)
+{
+    const auto gas_limit = static_cast<uint64_t>(tx.gas_limit);
+    const bytes_view to = tx.to.has_value() ? bytes_view{*tx.to} : bytes_view{};
+    if (tx.type == Transaction::Type::legacy)
+    {
+        // rlp [nonce, gas_price, gas_limit, to, value, data, v, r, s];
+        return visit(uint8_t{0}, std::forward_as_tuple(tx.nonce, tx.max_gas_price, gas_limit, to,
+                                     tx.value, tx.data, tx.v, tx.r, tx.s));
+    }
+
+    if (tx.v > 1)
+    {
+        throw std::invalid_argument(tx.type == Transaction::Type::access_list ?
+                                        "`v` value for eip2930 transaction must be 0 or 1" :
+                                        "`v` value for eip1559 transaction must be 0 or 1");
+    }
+    const auto sig_parity = static_cast<bool>(tx.v);
+    if (tx.type == Transaction::Type::access_list)
+    {
+        // tx_type +
+        // rlp [nonce, gas_price, gas_limit, to, value, data, access_list, v, r, s];
+        return visit(uint8_t{0x01},  // Transaction type (eip2930 type == 1)
+            std::forward_as_tuple(tx.chain_id, tx.nonce, tx.max_gas_price, gas_limit, to, tx.value,
+                tx.data, tx.access_list, sig_parity, tx.r, tx.s));
+    }
+
+    // tx_type +
+    // rlp [chain_id, nonce, max_priority_fee_per_gas, max_fee_per_gas, gas_limit, to, value,
+    // data, access_list, sig_parity, r, s];
+    return visit(uint8_t{0x02},  // Transaction type (eip1559 type == 2)
+        std::forward_as_tuple(tx.chain_id, tx.nonce, tx.max_priority_gas_price, tx.max_gas_price,
+            gas_limit, to, tx.value, tx.data, tx.access_list, sig_parity, tx.r, tx.s));
+}
+
+/// Defines how to RLP-encode a TransactionReceipt: as the list of the fields,
+/// in the EIP-2718 envelope for the receipts of the typed transactions.
+template <typename Visitor>
+inline auto rlp_typed_fields(const TransactionReceipt& receipt, Visitor&& visit)
+{
+    const auto cumulative_gas_used = static_cast<uint64_t>(receipt.cumulative_gas_used);
+    const bytes_view logs_bloom_filter{receipt.logs_bloom_filter};
+    if (receipt.post_state.has_value())
+    {
+        assert(receipt.type == Transaction::Type::legacy);
+        return visit(uint8_t{0}, std::forward_as_tuple(*receipt.post_state, cumulative_gas_used,
+                                     logs_bloom_filter, receipt.logs));
+    }
 
-/// Defines how to RLP-encode a TransactionReceipt.
-[[nodiscard]] bytes rlp_encode(const TransactionReceipt& receipt);
+    const auto success = receipt.status == EVMC_SUCCESS;
+    return visit(static_cast<uint8_t>(receipt.type),  // Legacy receipts have no envelope (0).
+        std::forward_as_tuple(success, cumulative_gas_used, logs_bloom_filter, receipt.logs));
+}
 
-/// Defines how to RLP-encode a Log.
-[[nodiscard]] bytes rlp_encode(const Log& log);
+/// Defines how to RLP-encode a Log: as the list of the fields.
+[[nodiscard]] inline auto rlp_fields(const Log& log) noexcept
+{
+    return std::tie(log.addr, log.topics, log.data);
+}
 
-/// Defines how to RLP-encode a Withdrawal.
-[[nodiscard]] bytes rlp_encode(const Withdrawal& withdrawal);
+/// Defines how to RLP-encode a Withdrawal: as the list of the fields.
+[[nodiscard]] inline auto rlp_fields(const Withdrawal& withdrawal) noexcept
+{
+    return std::tie(withdrawal.index, withdrawal.validator_index, withdrawal.recipient,
+        withdrawal.amount_in_gwei);
+}
 
 }  // namespace evmone::state
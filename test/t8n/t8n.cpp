@@ -15,6 +15,7 @@
 #include <fstream>
 #include <iostream>
 #include <string_view>
+#include <thread>
 
 namespace fs = std::filesystem;
 namespace json = nlohmann;
@@ -73,6 +74,7 @@ int main(int argc, const char* argv[])
 
         state::BlockInfo block;
         state::State state;
+        const auto num_threads = std::thread::hardware_concurrency();
 
         if (!alloc_file.empty())
         {
@@ -190,7 +192,7 @@ int main(int argc, const char* argv[])
                         cumulative_gas_used += receipt.gas_used;
                         receipt.cumulative_gas_used = cumulative_gas_used;
                         if (rev < EVMC_BYZANTIUM)
-                            receipt.post_state = state::mpt_hash(state.get_accounts());
+                            receipt.post_state = state.root_hash(num_threads);
                         j_receipt["cumulativeGasUsed"] = hex0x(cumulative_gas_used);
 
                         j_receipt["blockHash"] = hex0x(bytes32{});
@@ -215,7 +217,7 @@ int main(int argc, const char* argv[])
                 state, rev, block.coinbase, block_reward, block.ommers, block.withdrawals);
 
             j_result["logsHash"] = hex0x(logs_hash(txs_logs));
-            j_result["stateRoot"] = hex0x(state::mpt_hash(state.get_accounts()));
+            j_result["stateRoot"] = hex0x(state.root_hash(num_threads));
         }
 
         j_result["logsBloom"] = hex0x(compute_bloom_filter(receipts));
@@ -0,0 +1,105 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2023 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <evmc/mocked_host.hpp>
+#include <evmone/baseline_analysis_cache.hpp>
+#include <evmone/evmone.h>
+#include <evmone/vm.hpp>
+#include <gtest/gtest.h>
+#include <test/utils/bytecode.hpp>
+
+using evmone::baseline::CodeAnalysisCache;
+
+TEST(baseline_analysis_cache, hit)
+{
+    CodeAnalysisCache cache;
+    const auto code = bytes{push(1) + OP_JUMPDEST + OP_STOP};
+    const auto a = cache.get(EVMC_SHANGHAI, code);
+    const auto b = cache.get(EVMC_CANCUN, code);  // The legacy analysis is revision-independent.
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_EQ(cache.num_hits(), 1);
+    EXPECT_EQ(cache.num_misses(), 1);
+    EXPECT_TRUE(a->jumpdest_map[2]);
+}
+
+TEST(baseline_analysis_cache, code_changed_in_place)
+{
+    CodeAnalysisCache cache;
+    auto code = bytes{push(1) + OP_JUMPDEST + OP_STOP};
+    const auto a = cache.get(EVMC_SHANGHAI, code);
+    code[2] = OP_STOP;
+    const auto b = cache.get(EVMC_SHANGHAI, code);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_EQ(cache.num_misses(), 2);
+    EXPECT_TRUE(a->jumpdest_map[2]);  // The replaced analysis is still alive.
+    EXPECT_FALSE(b->jumpdest_map[2]);
+}
+
+TEST(baseline_analysis_cache, eviction)
+{
+    CodeAnalysisCache cache{2};
+    const auto code1 = bytes{push(1)};
+    const auto code2 = bytes{push(2)};
+    const auto code3 = bytes{push(3)};
+    const auto a = cache.get(EVMC_SHANGHAI, code1);
+    std::ignore = cache.get(EVMC_SHANGHAI, code2);
+    EXPECT_EQ(cache.get(EVMC_SHANGHAI, code1), a);  // code2 is now the least recently used.
+    std::ignore = cache.get(EVMC_SHANGHAI, code3);
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.get(EVMC_SHANGHAI, code1), a);
+    EXPECT_EQ(cache.num_misses(), 3);
+    std::ignore = cache.get(EVMC_SHANGHAI, code2);
+    EXPECT_EQ(cache.num_misses(), 4);
+
+    cache.set_capacity(0);
+    EXPECT_EQ(cache.size(), 0);
+    std::ignore = cache.get(EVMC_SHANGHAI, code1);
+    EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(baseline_analysis_cache, eof_not_cached)
+{
+    CodeAnalysisCache cache;
+    const auto code = eof1_bytecode(OP_STOP);
+    const auto analysis = cache.get(EVMC_PRAGUE, code);
+    EXPECT_EQ(analysis->eof_header.version, 1);
+    EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(baseline_analysis_cache, vm_option)
+{
+    auto vm = evmc_create_evmone();
+    auto& cache = static_cast<evmone::VM*>(vm)->analysis_cache;
+    EXPECT_EQ(vm->set_option(vm, "analysis-cache", "x"), EVMC_SET_OPTION_INVALID_VALUE);
+    EXPECT_EQ(vm->set_option(vm, "analysis-cache", "0"), EVMC_SET_OPTION_SUCCESS);
+    std::ignore = cache.get(EVMC_SHANGHAI, bytes{push(1)});
+    EXPECT_EQ(cache.size(), 0);
+    vm->destroy(vm);
+}
+
+TEST(baseline_analysis_cache, initcode_not_cached)
+{
+    evmc::VM vm{evmc_create_evmone()};
+    const auto& cache = static_cast<evmone::VM*>(vm.get_raw_pointer())->analysis_cache;
+    evmc::MockedHost host;
+    const auto code = bytes{push(1) + OP_STOP};
+    evmc_message msg{};
+    msg.gas = 100;
+
+    for (const auto kind : {EVMC_CREATE, EVMC_CREATE2})
+    {
+        msg.kind = kind;
+        EXPECT_EQ(vm.execute(host, EVMC_SHANGHAI, msg, code.data(), code.size()).status_code,
+            EVMC_SUCCESS);
+    }
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_EQ(cache.num_misses(), 0);
+
+    msg.kind = EVMC_CALL;
+    EXPECT_EQ(vm.execute(host, EVMC_SHANGHAI, msg, code.data(), code.size()).status_code,
+        EVMC_SUCCESS);
+    EXPECT_EQ(cache.size(), 1);
+}
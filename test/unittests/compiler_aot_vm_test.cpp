@@ -0,0 +1,236 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+/// Tests of the VM executing the compiled contracts (aot_vm.hpp) and of their registry
+/// (registry.hpp). The native code of the contract registered by the test library
+/// (compiler_registry_test_object.cpp) returns the address of its ExecutionState.
+
+#include <compiler/aot_vm.hpp>
+#include <evmc/mocked_host.hpp>
+#include <gtest/gtest.h>
+#include <cstring>
+
+using namespace evmone;
+using namespace evmc::literals;
+
+namespace
+{
+constexpr auto native_address = 0x01_address;
+constexpr auto interpreted_address = 0x02_address;
+
+/// The code hash of the contract in the test library.
+evmc::bytes32 native_code_hash() noexcept
+{
+    evmc::bytes32 hash;
+    hash.bytes[0] = 0xaa;
+    return hash;
+}
+
+/// PUSH1 1 PUSH1 0 MSTORE8 PUSH1 1 PUSH1 0 RETURN: returns the byte 0x01.
+const bytes code{0x60, 0x01, 0x60, 0x00, 0x53, 0x60, 0x01, 0x60, 0x00, 0xf3};
+
+/// Returns the address of the ExecutionState of the native execution.
+uintptr_t state_address(const evmc::Result& result) noexcept
+{
+    uintptr_t address = 0;
+    if (result.output_size == sizeof(address))
+        std::memcpy(&address, result.output_data, sizeof(address));
+    return address;
+}
+
+class compiler_aot_vm : public testing::Test
+{
+protected:
+    evmc::VM vm{evmc_create_evmone_aot()};
+    AotVM& aot = *static_cast<AotVM*>(vm.get_raw_pointer());
+    evmc::MockedHost host;
+
+    compiler_aot_vm()
+    {
+        host.accounts[native_address].codehash = native_code_hash();
+        host.accounts[interpreted_address].codehash = 0x02_bytes32;
+    }
+
+    evmc::Result execute(evmc::address address, evmc_revision rev = EVMC_SHANGHAI,
+        evmc_call_kind kind = EVMC_CALL, int32_t depth = 0)
+    {
+        evmc_message msg{};
+        msg.kind = kind;
+        msg.depth = depth;
+        msg.gas = 100000;
+        msg.recipient = address;
+        msg.code_address = address;
+        return vm.execute(host, rev, msg, code.data(), code.size());
+    }
+};
+}  // namespace
+
+TEST_F(compiler_aot_vm, native_and_fallback)
+{
+    ASSERT_EQ(vm.set_option("registry", EVMONE_COMPILER_TEST_CONTRACTS), EVMC_SET_OPTION_SUCCESS);
+    EXPECT_TRUE(aot.active());
+    EXPECT_FALSE(aot.tiering());
+
+    const auto native = execute(native_address);
+    EXPECT_EQ(native.status_code, EVMC_SUCCESS);
+    EXPECT_NE(state_address(native), 0);
+    EXPECT_EQ(aot.num_native_calls.load(), 1);
+    EXPECT_EQ(aot.num_fallback_calls.load(), 0);
+
+    const auto interpreted = execute(interpreted_address);
+    EXPECT_EQ(interpreted.status_code, EVMC_SUCCESS);
+    ASSERT_EQ(interpreted.output_size, 1);
+    EXPECT_EQ(interpreted.output_data[0], 0x01);
+    EXPECT_EQ(aot.num_native_calls.load(), 1);
+    EXPECT_EQ(aot.num_fallback_calls.load(), 1);
+
+    // The contract is only compiled for Shanghai.
+    const auto other_revision = execute(native_address, EVMC_PARIS);
+    ASSERT_EQ(other_revision.output_size, 1);
+    EXPECT_EQ(aot.num_native_calls.load(), 1);
+    EXPECT_EQ(aot.num_fallback_calls.load(), 2);
+}
+
+TEST_F(compiler_aot_vm, inactive)
+{
+    // Without the registry and the cache every call is interpreted.
+    EXPECT_FALSE(aot.active());
+    const auto result = execute(native_address);
+    ASSERT_EQ(result.output_size, 1);
+    EXPECT_EQ(aot.num_native_calls.load(), 0);
+    EXPECT_EQ(aot.num_fallback_calls.load(), 1);
+}
+
+TEST_F(compiler_aot_vm, create_interpreted)
+{
+    ASSERT_EQ(vm.set_option("registry", EVMONE_COMPILER_TEST_CONTRACTS), EVMC_SET_OPTION_SUCCESS);
+
+    // The initcode is executed by the interpreter, even at the address of a compiled contract.
+    for (const auto kind : {EVMC_CREATE, EVMC_CREATE2})
+    {
+        const auto result = execute(native_address, EVMC_SHANGHAI, kind);
+        EXPECT_EQ(result.status_code, EVMC_SUCCESS);
+        ASSERT_EQ(result.output_size, 1);
+        EXPECT_EQ(result.output_data[0], 0x01);
+    }
+    EXPECT_EQ(aot.num_native_calls.load(), 0);
+    EXPECT_EQ(aot.num_fallback_calls.load(), 2);
+}
+
+TEST_F(compiler_aot_vm, native_state_pool)
+{
+    ASSERT_EQ(vm.set_option("registry", EVMONE_COMPILER_TEST_CONTRACTS), EVMC_SET_OPTION_SUCCESS);
+
+    // The calls at the same depth reuse the state, the calls at other depths have their own.
+    const auto depth0 = state_address(execute(native_address));
+    const auto depth1 = state_address(execute(native_address, EVMC_SHANGHAI, EVMC_CALL, 1));
+    ASSERT_NE(depth0, 0);
+    ASSERT_NE(depth1, 0);
+    EXPECT_NE(depth1, depth0);
+    EXPECT_EQ(state_address(execute(native_address)), depth0);
+    EXPECT_EQ(state_address(execute(native_address, EVMC_SHANGHAI, EVMC_CALL, 1)), depth1);
+
+    // A message of an invalid depth gets a state of its own, not pooled.
+    EXPECT_NE(state_address(execute(native_address, EVMC_SHANGHAI, EVMC_CALL, -1)), 0);
+    EXPECT_EQ(aot.num_native_calls.load(), 5);
+}
+
+TEST_F(compiler_aot_vm, options)
+{
+    EXPECT_EQ(vm.set_option("registry", "nonexistent.so"), EVMC_SET_OPTION_INVALID_VALUE);
+    EXPECT_EQ(vm.set_option("registry", EVMONE_COMPILER_TEST_OBJECT),
+        EVMC_SET_OPTION_INVALID_VALUE);  // No table of compiled contracts.
+
+    EXPECT_EQ(vm.set_option("cache-budget", "16"), EVMC_SET_OPTION_SUCCESS);
+    EXPECT_EQ(aot.cache_budget, uint64_t{16} << 20);
+    EXPECT_EQ(vm.set_option("cache-budget", "16M"), EVMC_SET_OPTION_INVALID_VALUE);
+    EXPECT_EQ(vm.set_option("cache-budget", ""), EVMC_SET_OPTION_INVALID_VALUE);
+
+    EXPECT_EQ(vm.set_option("tier-calls", "10"), EVMC_SET_OPTION_SUCCESS);
+    EXPECT_EQ(aot.profiler.thresholds.num_calls, 10);
+    EXPECT_EQ(vm.set_option("tier-calls", "-1"), EVMC_SET_OPTION_INVALID_VALUE);
+    EXPECT_EQ(vm.set_option("tier-gas", "1000000"), EVMC_SET_OPTION_SUCCESS);
+    EXPECT_EQ(aot.profiler.thresholds.gas_used, 1000000);
+    EXPECT_EQ(vm.set_option("tier-gas", "x"), EVMC_SET_OPTION_INVALID_VALUE);
+    // Tiering requires the cache.
+    EXPECT_FALSE(aot.tiering());
+
+    EXPECT_EQ(vm.set_option("tier-contracts", "100"), EVMC_SET_OPTION_SUCCESS);
+    EXPECT_EQ(aot.profiler.max_contracts, 100);
+    EXPECT_EQ(vm.set_option("tier-contracts", "0"), EVMC_SET_OPTION_INVALID_VALUE);
+
+    EXPECT_EQ(vm.set_option("compile-threads", "4"), EVMC_SET_OPTION_SUCCESS);
+    EXPECT_EQ(aot.num_compile_threads, 4);
+    EXPECT_EQ(vm.set_option("compile-threads", "0"), EVMC_SET_OPTION_INVALID_VALUE);
+    EXPECT_EQ(vm.set_option("compile-threads", "257"), EVMC_SET_OPTION_INVALID_VALUE);
+    EXPECT_EQ(aot.num_compile_threads, 4);
+
+    EXPECT_EQ(vm.set_option("compile-queue", "0"), EVMC_SET_OPTION_SUCCESS);
+    EXPECT_EQ(aot.max_pending_compilations, 0);
+    EXPECT_EQ(vm.set_option("compile-queue", "many"), EVMC_SET_OPTION_INVALID_VALUE);
+
+    // The other options are the interpreter's.
+    EXPECT_EQ(vm.set_option("analysis-cache", "16"), EVMC_SET_OPTION_SUCCESS);
+    EXPECT_EQ(vm.set_option("analysis-cache", "x"), EVMC_SET_OPTION_INVALID_VALUE);
+    EXPECT_EQ(vm.set_option("unknown", ""), EVMC_SET_OPTION_INVALID_NAME);
+}
+
+TEST(compiler_registry, load)
+{
+    ContractRegistry registry;
+    std::string error;
+    EXPECT_FALSE(registry.load("nonexistent.so", &error));
+    EXPECT_FALSE(error.empty());
+    EXPECT_FALSE(registry.load(EVMONE_COMPILER_TEST_OBJECT, &error));
+    EXPECT_NE(error.find("no table of compiled contracts"), std::string::npos);
+    EXPECT_EQ(registry.size(), 0);
+
+    ASSERT_TRUE(registry.load(EVMONE_COMPILER_TEST_CONTRACTS, &error));
+    EXPECT_EQ(registry.size(), 1);
+    EXPECT_NE(registry.find(native_code_hash(), EVMC_SHANGHAI), nullptr);
+    EXPECT_EQ(registry.find(native_code_hash(), EVMC_PARIS), nullptr);
+    EXPECT_EQ(registry.find(0x02_bytes32, EVMC_SHANGHAI), nullptr);
+
+    // The contracts added later replace the loaded ones.
+    const auto fn = registry.find(native_code_hash(), EVMC_SHANGHAI);
+    registry.add(0x02_bytes32, EVMC_SHANGHAI, fn);
+    EXPECT_EQ(registry.find(0x02_bytes32, EVMC_SHANGHAI), fn);
+    EXPECT_EQ(registry.size(), 2);
+}
+
+TEST(compiler_registry, missing)
+{
+    ContractRegistry registry;
+    EXPECT_FALSE(registry.missing(0x01_bytes32, EVMC_SHANGHAI, 0));
+
+    registry.add_missing(0x01_bytes32, EVMC_SHANGHAI, 1);
+    EXPECT_TRUE(registry.missing(0x01_bytes32, EVMC_SHANGHAI, 1));
+    EXPECT_FALSE(registry.missing(0x01_bytes32, EVMC_PARIS, 1));
+    // The misses of another generation of the cache are not known.
+    EXPECT_FALSE(registry.missing(0x01_bytes32, EVMC_SHANGHAI, 2));
+
+    // A miss of an older generation is outdated.
+    registry.add_missing(0x02_bytes32, EVMC_SHANGHAI, 0);
+    EXPECT_FALSE(registry.missing(0x02_bytes32, EVMC_SHANGHAI, 0));
+    EXPECT_FALSE(registry.missing(0x02_bytes32, EVMC_SHANGHAI, 1));
+
+    // A miss of a newer generation forgets the others.
+    registry.add_missing(0x02_bytes32, EVMC_SHANGHAI, 2);
+    EXPECT_TRUE(registry.missing(0x02_bytes32, EVMC_SHANGHAI, 2));
+    EXPECT_FALSE(registry.missing(0x01_bytes32, EVMC_SHANGHAI, 2));
+}
+
+TEST(compiler_registry, missing_bounded)
+{
+    ContractRegistry registry;
+    for (uint64_t i = 0; i < ContractRegistry::max_missing; ++i)
+        registry.add_missing(evmc::bytes32{i}, EVMC_SHANGHAI, 1);
+    EXPECT_TRUE(registry.missing(evmc::bytes32{0}, EVMC_SHANGHAI, 1));
+
+    // The set is full: it is cleared for the new miss.
+    registry.add_missing(evmc::bytes32{ContractRegistry::max_missing}, EVMC_SHANGHAI, 1);
+    EXPECT_FALSE(registry.missing(evmc::bytes32{0}, EVMC_SHANGHAI, 1));
+    EXPECT_TRUE(
+        registry.missing(evmc::bytes32{ContractRegistry::max_missing}, EVMC_SHANGHAI, 1));
+}
@@ -0,0 +1,98 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+/// Tests of the batch mode of the compiler (batch.hpp).
+
+#include "compiler_test_utils.hpp"
+#include <compiler/batch.hpp>
+#include <gtest/gtest.h>
+#include <fstream>
+
+using namespace evmone;
+using evmone::test::make_temp_dir;
+namespace fs = std::filesystem;
+
+namespace
+{
+void write_file(const fs::path& path, std::string_view content)
+{
+    std::ofstream{path, std::ios::binary} << content;
+}
+}  // namespace
+
+TEST(compiler_batch, load_directory)
+{
+    const auto dir = make_temp_dir("codes");
+    write_file(dir / "b", "0x6001\n6000\n");
+    write_file(dir / "a", "  00 ");
+    write_file(dir / "c", "");                   // Empty: skipped.
+    write_file(dir / "d", "00");                 // Duplicate of a.
+    fs::create_directories(dir / "e");           // Not a file.
+    write_file(dir / "e" / "f", "fe");
+
+    std::vector<bytes> codes;
+    std::string error;
+    ASSERT_TRUE(load_batch(dir, codes, &error)) << error;
+    EXPECT_EQ(codes, (std::vector<bytes>{{0x00}, {0x60, 0x01, 0x60, 0x00}}));
+
+    // The codes already given are not repeated.
+    ASSERT_TRUE(load_batch(dir, codes, &error)) << error;
+    EXPECT_EQ(codes.size(), 2);
+
+    write_file(dir / "g", "0xzz");
+    codes.clear();
+    EXPECT_FALSE(load_batch(dir, codes, &error));
+    EXPECT_EQ(error, (dir / "g").string() + ": invalid hex code");
+}
+
+TEST(compiler_batch, load_json)
+{
+    const auto dir = make_temp_dir("alloc");
+    const auto path = dir / "alloc.json";
+    write_file(path, R"({
+        "0x1000": {"balance": "0x01", "code" : "0x6001", "storage": {}},
+        "0x2000": {"code":"0x", "nonce": "0x00"},
+        "0x3000": {"name": "code", "code":
+            "0x00"},
+        "0x4000": {"code": "0x6001"}
+    })");
+
+    std::vector<bytes> codes;
+    std::string error;
+    ASSERT_TRUE(load_batch(path, codes, &error)) << error;
+    EXPECT_EQ(codes, (std::vector<bytes>{{0x60, 0x01}, {0x00}}));
+
+    write_file(path, R"({"code": "0x600"})");
+    codes.clear();
+    EXPECT_FALSE(load_batch(path, codes, &error));
+    EXPECT_EQ(error, path.string() + ": invalid hex code");
+
+    codes.clear();
+    EXPECT_FALSE(load_batch(dir / "missing.json", codes, &error));
+    EXPECT_EQ(error, (dir / "missing.json").string() + ": cannot read the file");
+}
+
+TEST(compiler_batch, write_project)
+{
+    const auto dir = make_temp_dir("project");
+    const std::vector<bytes> codes{{0x60, 0x01, 0x00}, {0x00}};
+    std::string error;
+    ASSERT_TRUE(write_batch_project(dir, EVMC_SHANGHAI, codes, {}, &error)) << error;
+    for (const auto& code : codes)
+        EXPECT_TRUE(fs::exists(dir / (contract_name(code) + ".cpp")));
+    EXPECT_TRUE(fs::exists(dir / "registry.cpp"));
+    EXPECT_TRUE(fs::exists(dir / "CMakeLists.txt"));
+
+    // Only the changed files are rewritten.
+    const auto unit = dir / (contract_name(codes[0]) + ".cpp");
+    const auto old_time = fs::file_time_type::clock::now() - std::chrono::hours{1};
+    fs::last_write_time(unit, old_time);
+    fs::last_write_time(dir / "registry.cpp", old_time);
+    ASSERT_TRUE(write_batch_project(dir, EVMC_SHANGHAI, {codes[0]}, {}, &error)) << error;
+    EXPECT_EQ(fs::last_write_time(unit), old_time);
+    EXPECT_NE(fs::last_write_time(dir / "registry.cpp"), old_time);
+
+    EXPECT_FALSE(write_batch_project(dir, EVMC_SHANGHAI, {}, {}, &error));
+    EXPECT_EQ(error, "no contracts to compile");
+}
@@ -0,0 +1,205 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+/// Tests of the compiled code cache (cache.hpp), with a prebuilt shared object standing in
+/// for the compiled contracts.
+
+#include "compiler_test_utils.hpp"
+#include <compiler/cache.hpp>
+#include <gtest/gtest.h>
+#include <fstream>
+
+using namespace evmone;
+using evmone::test::make_temp_dir;
+namespace fs = std::filesystem;
+
+namespace
+{
+/// Returns the key of a distinct contract for every number: PUSH1 n STOP.
+CacheKey make_key(uint8_t n)
+{
+    return {EVMC_SHANGHAI, bytes{0x60, n, 0x00}, CompileOptions{}};
+}
+
+/// Copies the test shared object to a new file of the given name, ready for insertion.
+fs::path make_object(const fs::path& dir, std::string_view name)
+{
+    const auto path = dir / name;
+    fs::copy_file(EVMONE_COMPILER_TEST_OBJECT, path, fs::copy_options::overwrite_existing);
+    return path;
+}
+
+uint64_t object_size()
+{
+    return fs::file_size(EVMONE_COMPILER_TEST_OBJECT);
+}
+}  // namespace
+
+TEST(compiler_cache, insert_and_find)
+{
+    const auto staging = make_temp_dir("staging");
+    const auto dir = make_temp_dir("cache");
+    std::string error;
+    const auto cache = CodeCache::open(dir, 1 << 30, &error);
+    ASSERT_NE(cache, nullptr) << error;
+
+    const auto key = make_key(1);
+    EXPECT_FALSE(cache->contains(key));
+    EXPECT_EQ(cache->find(key), nullptr);
+
+    const auto object = make_object(staging, "a.so");
+    ASSERT_TRUE(cache->insert(key, object, &error)) << error;
+    EXPECT_FALSE(fs::exists(object));
+    EXPECT_TRUE(cache->contains(key));
+    EXPECT_EQ(cache->size(), 1);
+    EXPECT_EQ(cache->total_size(), object_size());
+    EXPECT_NE(cache->find(key), nullptr);
+
+    // The existing entry wins.
+    const auto again = make_object(staging, "b.so");
+    ASSERT_TRUE(cache->insert(key, again, &error)) << error;
+    EXPECT_FALSE(fs::exists(again));
+    EXPECT_EQ(cache->size(), 1);
+}
+
+TEST(compiler_cache, key_includes_revision_options_and_abi)
+{
+    const auto staging = make_temp_dir("staging");
+    const auto dir = make_temp_dir("cache");
+    const auto cache = CodeCache::open(dir, 1 << 30);
+    ASSERT_NE(cache, nullptr);
+    const auto key = make_key(1);
+    ASSERT_TRUE(cache->insert(key, make_object(staging, "a.so")));
+
+    auto other = key;
+    other.rev = EVMC_PARIS;
+    EXPECT_FALSE(cache->contains(other));
+
+    CompileOptions options;
+    options.opt_level = 3;
+    EXPECT_FALSE(cache->contains({key.code_hash, key.rev, options}));
+
+    other = key;
+    other.abi = CacheKey::current_abi + 1;
+    EXPECT_FALSE(cache->contains(other));
+    EXPECT_EQ(cache->find(other), nullptr);
+}
+
+TEST(compiler_cache, broken_object_dropped)
+{
+    const auto staging = make_temp_dir("staging");
+    const auto dir = make_temp_dir("cache");
+    const auto cache = CodeCache::open(dir, 1 << 30);
+    ASSERT_NE(cache, nullptr);
+
+    const auto key = make_key(1);
+    std::ofstream{staging / "broken.so"} << "not a shared object";
+    ASSERT_TRUE(cache->insert(key, staging / "broken.so"));
+    EXPECT_TRUE(cache->contains(key));
+
+    EXPECT_EQ(cache->find(key), nullptr);
+    EXPECT_FALSE(cache->contains(key));
+    EXPECT_EQ(cache->size(), 0);
+    EXPECT_EQ(cache->total_size(), 0);
+}
+
+TEST(compiler_cache, lru_eviction)
+{
+    const auto staging = make_temp_dir("staging");
+    const auto dir = make_temp_dir("cache");
+    const auto cache = CodeCache::open(dir, 3 * object_size());
+    ASSERT_NE(cache, nullptr);
+
+    const auto a = make_key(1);
+    const auto b = make_key(2);
+    const auto c = make_key(3);
+    const auto d = make_key(4);
+    ASSERT_TRUE(cache->insert(a, make_object(staging, "a.so")));
+    ASSERT_TRUE(cache->insert(b, make_object(staging, "b.so")));
+    ASSERT_TRUE(cache->insert(c, make_object(staging, "c.so")));
+    EXPECT_EQ(cache->size(), 3);
+
+    // The lookup makes a the most recently used: b is the least recently used.
+    EXPECT_NE(cache->find(a), nullptr);
+    ASSERT_TRUE(cache->insert(d, make_object(staging, "d.so")));
+    EXPECT_EQ(cache->size(), 3);
+    EXPECT_EQ(cache->total_size(), 3 * object_size());
+    EXPECT_TRUE(cache->contains(a));
+    EXPECT_FALSE(cache->contains(b));
+    EXPECT_TRUE(cache->contains(c));
+    EXPECT_TRUE(cache->contains(d));
+
+    // The evicted objects are deleted.
+    size_t num_objects = 0;
+    for (const auto& file : fs::directory_iterator{dir})
+        num_objects += file.path().extension() == ".so";
+    EXPECT_EQ(num_objects, 3);
+}
+
+TEST(compiler_cache, lru_eviction_keeps_last)
+{
+    const auto staging = make_temp_dir("staging");
+    const auto dir = make_temp_dir("cache");
+    const auto cache = CodeCache::open(dir, 1);
+    ASSERT_NE(cache, nullptr);
+
+    ASSERT_TRUE(cache->insert(make_key(1), make_object(staging, "a.so")));
+    ASSERT_TRUE(cache->insert(make_key(2), make_object(staging, "b.so")));
+    EXPECT_FALSE(cache->contains(make_key(1)));
+    EXPECT_TRUE(cache->contains(make_key(2)));
+}
+
+TEST(compiler_cache, shared_directory)
+{
+    const auto staging = make_temp_dir("staging");
+    const auto dir = make_temp_dir("cache");
+    const auto first = CodeCache::open(dir, 2 * object_size());
+    const auto second = CodeCache::open(dir, 2 * object_size());
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+
+    // The entries inserted by one instance are seen by the other.
+    ASSERT_TRUE(first->insert(make_key(1), make_object(staging, "a.so")));
+    EXPECT_TRUE(second->contains(make_key(1)));
+    EXPECT_NE(second->find(make_key(1)), nullptr);
+
+    ASSERT_TRUE(second->insert(make_key(2), make_object(staging, "b.so")));
+    ASSERT_TRUE(second->insert(make_key(3), make_object(staging, "c.so")));
+    EXPECT_EQ(first->size(), 2);
+    EXPECT_FALSE(first->contains(make_key(1)));
+    EXPECT_TRUE(first->contains(make_key(3)));
+
+    // And they persist.
+    const auto reopened = CodeCache::open(dir, 2 * object_size());
+    ASSERT_NE(reopened, nullptr);
+    EXPECT_EQ(reopened->size(), 2);
+    EXPECT_TRUE(reopened->contains(make_key(2)));
+}
+
+TEST(compiler_cache, generation)
+{
+    const auto staging = make_temp_dir("staging");
+    const auto dir = make_temp_dir("cache");
+    const auto cache = CodeCache::open(dir, 1 << 30);
+    const auto other = CodeCache::open(dir, 1 << 30);
+    ASSERT_NE(cache, nullptr);
+    ASSERT_NE(other, nullptr);
+
+    // The lookups do not change the generation.
+    const auto initial = cache->generation();
+    EXPECT_EQ(cache->find(make_key(1)), nullptr);
+    EXPECT_EQ(cache->generation(), initial);
+
+    ASSERT_TRUE(cache->insert(make_key(1), make_object(staging, "a.so")));
+    const auto inserted = cache->generation();
+    EXPECT_NE(inserted, initial);
+    EXPECT_NE(cache->find(make_key(1)), nullptr);
+    EXPECT_EQ(cache->generation(), inserted);
+
+    // The changes made by another instance are seen at once.
+    EXPECT_EQ(other->generation(), inserted);
+    ASSERT_TRUE(other->insert(make_key(2), make_object(staging, "b.so")));
+    EXPECT_NE(cache->generation(), inserted);
+    EXPECT_EQ(cache->generation(), other->generation());
+}
@@ -0,0 +1,11 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+/// A stand-in for a compiled contract loaded by the CodeCache tests: a shared object
+/// exporting the entry point (which is never called).
+
+extern "C" __attribute__((visibility("default"))) int evmone_aot_entry()
+{
+    return 0;
+}
@@ -0,0 +1,236 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+/// Tests of the control flow analyses of the compiler (codegen.cpp) through the generated
+/// C++ code of small contracts.
+
+#include <compiler/codegen.hpp>
+#include <evmc/hex.hpp>
+#include <gtest/gtest.h>
+
+using namespace evmone;
+
+namespace
+{
+std::string compile(std::string_view hex, const CompileOptions& options)
+{
+    return compile_cxx(EVMC_SHANGHAI, *evmc::from_hex(hex), options);
+}
+
+bool contains(const std::string& cxx, std::string_view snippet)
+{
+    return cxx.find(snippet) != std::string::npos;
+}
+
+/// Returns the number of the occurrences of the snippet.
+int count(const std::string& cxx, std::string_view snippet)
+{
+    int n = 0;
+    for (auto pos = cxx.find(snippet); pos != std::string::npos; pos = cxx.find(snippet, pos + 1))
+        ++n;
+    return n;
+}
+}  // namespace
+
+TEST(compiler_codegen, regions_split_at_budget)
+{
+    // PUSH1 1 PUSH1 5 JUMP; 5: JUMPDEST PUSH1 1 POP STOP
+    constexpr auto code = "6001600556""5b60015000";
+    CompileOptions options;
+    options.max_region_size = 3;
+    const auto cxx = compile(code, options);
+    EXPECT_TRUE(contains(cxx, "_region_0(ExecutionState& state, RegionContext& region)"));
+    EXPECT_TRUE(contains(cxx, "_region_1(ExecutionState& state, RegionContext& region)"));
+    EXPECT_FALSE(contains(cxx, "_region_2("));
+
+    // The first region leaves at the JUMPDEST, which enters the second one.
+    EXPECT_TRUE(contains(cxx, "REGION_EXIT(5)\n"));
+    EXPECT_TRUE(contains(cxx,
+        "REGION_TRAMPOLINE_BEGIN(0)\nREGION_CASE(0)\nREGION_CALL(" + contract_name(
+            *evmc::from_hex(code)) + "_region_0)\nREGION_CASE(5)\n"));
+
+    options.max_region_size = 0;
+    EXPECT_FALSE(contains(compile(code, options), "_region_"));
+}
+
+TEST(compiler_codegen, regions_keep_loops)
+{
+    // 0: JUMPDEST CALLDATASIZE PUSH1 8 JUMPI; PUSH1 0 JUMP; 8: JUMPDEST STOP
+    // The loop (the blocks at 0 and 5) is larger than a region but is not split.
+    CompileOptions options;
+    options.max_region_size = 1;
+    const auto cxx = compile("5b36600857""600056""5b00", options);
+    EXPECT_TRUE(contains(cxx, "REGION_CASE(0)\n"));
+    EXPECT_TRUE(contains(cxx, "REGION_CASE(8)\n"));
+    EXPECT_FALSE(contains(cxx, "REGION_CASE(5)\n"));
+    EXPECT_FALSE(contains(cxx, "REGION_EXIT(5)\n"));
+}
+
+TEST(compiler_codegen, regions_entered_by_fallthrough)
+{
+    // PUSH1 1 PUSH1 1 ADD PUSH1 11 JUMPI; 8: PUSH1 0 STOP; 11: JUMPDEST STOP
+    // The block at 8 (not a JUMPDEST) follows the JUMPI in the other region.
+    CompileOptions options;
+    options.max_region_size = 5;
+    const auto cxx = compile("600160010160""0b57""600000""5b00", options);
+    EXPECT_TRUE(contains(cxx, "REGION_EXIT(8)\n"));
+    EXPECT_TRUE(contains(cxx, "REGION_EXIT(11)\n"));
+    EXPECT_TRUE(contains(cxx, "REGION_CASE(8)\nREGION_CASE(11)\n"));
+
+    // The entries are numbered as the jump targets.
+    EXPECT_TRUE(contains(cxx, "_jumpdest_index {1,0,0,0,0,0,0,0,2,0,0,3};\n"));
+}
+
+TEST(compiler_codegen, rotate_loop)
+{
+    // 0: JUMPDEST CALLDATASIZE PUSH1 8 JUMPI; PUSH1 0 JUMP; 8: JUMPDEST STOP
+    // The jump back to the loop test is replaced by a copy of the test.
+    constexpr auto code = "5b36600857""600056""5b00";
+    const auto cxx = compile(code, {});
+    EXPECT_TRUE(contains(cxx, "LOOP_ROTATE(0)\n"));
+    EXPECT_EQ(count(cxx, "PUSHnJUMPI(8)\n"), 2);
+    EXPECT_FALSE(contains(cxx, "PUSHnJUMP(0)\n"));
+    EXPECT_TRUE(contains(cxx, "goto L_OFFSET_5;\n"));
+
+    CompileOptions options;
+    options.rotate_loops = false;
+    EXPECT_FALSE(contains(compile(code, options), "LOOP_ROTATE"));
+
+    // The rotation relies on PUSHnJUMP.
+    options = {};
+    options.push_n_jump = false;
+    EXPECT_FALSE(contains(compile(code, options), "LOOP_ROTATE"));
+}
+
+TEST(compiler_codegen, rotate_loop_without_test)
+{
+    // 0: JUMPDEST PUSH1 0 JUMP
+    // The header does not end with a conditional jump: there is nothing to rotate.
+    EXPECT_FALSE(contains(compile("5b600056", {}), "LOOP_ROTATE"));
+}
+
+TEST(compiler_codegen, gas_check_cycle)
+{
+    // 0: JUMPDEST PUSH1 0 JUMP
+    CompileOptions options;
+    options.gas_check_loc = 3;
+    EXPECT_EQ(count(compile("5b600056", options), "GAS_CHECK\n"), 1);
+
+    // Other locations are handled by the macros.
+    options.gas_check_loc = 1;
+    EXPECT_EQ(count(compile("5b600056", options), "GAS_CHECK\n"), 0);
+}
+
+TEST(compiler_codegen, gas_check_dynamic_jump)
+{
+    // CALLDATASIZE JUMP; 2: JUMPDEST STOP
+    // The unresolved jump may go back anywhere.
+    CompileOptions options;
+    options.gas_check_loc = 3;
+    EXPECT_EQ(count(compile("3656""5b00", options), "GAS_CHECK\n"), 1);
+}
+
+TEST(compiler_codegen, gas_check_budget)
+{
+    CompileOptions options;
+    options.gas_check_loc = 3;
+
+    // PUSH1 1 PUSH1 2 ADD POP STOP: no cycle, no successor.
+    EXPECT_EQ(count(compile("6001600201""5000", options), "GAS_CHECK\n"), 0);
+
+    // PUSH1 0 PUSH1 6 JUMPI; STOP; 6: JUMPDEST STOP
+    // The first block uses 16 gas before its successors.
+    constexpr auto code = "6000600657""00""5b00";
+    options.gas_check_budget = 10;
+    EXPECT_EQ(count(compile(code, options), "GAS_CHECK\n"), 1);
+    options.gas_check_budget = 1000;
+    EXPECT_EQ(count(compile(code, options), "GAS_CHECK\n"), 0);
+}
+
+TEST(compiler_codegen, promote_stack)
+{
+    // PUSH1 1 PUSH1 2 ADD POP STOP
+    // The run is computed in local variables and leaves the stack unchanged.
+    constexpr auto code = "6001600201""5000";
+    auto cxx = compile(code, {});
+    EXPECT_TRUE(contains(cxx, "{\nconst uint256 t0 = 0x2_u256 + 0x1_u256;\n}\n"));
+    EXPECT_FALSE(contains(cxx, "INVOKE(ADD)"));
+
+    CompileOptions options;
+    options.promote_stack = false;
+    cxx = compile(code, options);
+    EXPECT_FALSE(contains(cxx, "const uint256 t0"));
+    EXPECT_TRUE(contains(cxx, "INVOKE(ADD)\n"));
+}
+
+TEST(compiler_codegen, promote_stack_spill)
+{
+    // PUSH1 1 ADD STOP
+    // The consumed item is loaded, the result replaces it.
+    EXPECT_TRUE(contains(compile("600101""00", {}),
+        "const uint256 s0 = stack[0];\nconst uint256 t0 = 0x1_u256 + s0;\n"
+        "stack.drop(1);\nstack.push(t0);\n"));
+
+    // DUP1 DUP1 POP POP STOP
+    // The loaded item is still in its place: nothing is written back.
+    const auto cxx = compile("8080""5050""00", {});
+    EXPECT_TRUE(contains(cxx, "const uint256 s0 = stack[0];\n}\n"));
+    EXPECT_FALSE(contains(cxx, "stack.drop("));
+    EXPECT_FALSE(contains(cxx, "stack.push("));
+}
+
+TEST(compiler_codegen, promote_stack_single_instruction)
+{
+    // PUSH1 1 STOP: a run of one instruction is not promoted.
+    const auto cxx = compile("6001""00", {});
+    EXPECT_TRUE(contains(cxx, "INVOKE(PUSH1, 0x1_u256)\n"));
+    EXPECT_FALSE(contains(cxx, "const uint256 "));
+}
+
+TEST(compiler_codegen, resolve_jump_single_target)
+{
+    // PUSH1 7 PUSH1 5 JUMP; 5: JUMPDEST JUMP; 7: JUMPDEST STOP
+    // The return address 7 is pushed before the jump to 5.
+    constexpr auto code = "6007600556""5b56""5b00";
+    auto cxx = compile(code, {});
+    EXPECT_TRUE(contains(cxx, "JUMP_TO(7)\n"));
+    EXPECT_FALSE(contains(cxx, "INVOKE(JUMP, jumpdest_map)"));
+
+    // A resolved jump does not need a gas check.
+    CompileOptions options;
+    options.gas_check_loc = 3;
+    EXPECT_EQ(count(compile(code, options), "GAS_CHECK\n"), 0);
+
+    options = {};
+    options.max_jump_targets = 0;
+    cxx = compile(code, options);
+    EXPECT_FALSE(contains(cxx, "JUMP_TO("));
+    EXPECT_TRUE(contains(cxx, "INVOKE(JUMP, jumpdest_map)"));
+}
+
+TEST(compiler_codegen, resolve_jump_switch)
+{
+    // CALLDATASIZE PUSH1 10 JUMPI; PUSH1 16 PUSH1 20 JUMP; STOP;
+    // 10: JUMPDEST PUSH1 18 PUSH1 20 JUMP; 16: JUMPDEST STOP; 18: JUMPDEST STOP; 20: JUMPDEST JUMP
+    // The jump at 20 returns to 16 or 18.
+    constexpr auto code = "36600a57""6010601456""00""5b6012601456""5b00""5b00""5b56";
+    auto cxx = compile(code, {});
+    EXPECT_TRUE(contains(cxx, "JUMP_SWITCH\nJUMP_CASE(16)\nJUMP_CASE(18)\nJUMP_SWITCH_END\n"));
+    EXPECT_FALSE(contains(cxx, "INVOKE(JUMP, jumpdest_map)"));
+
+    CompileOptions options;
+    options.max_jump_targets = 1;
+    cxx = compile(code, options);
+    EXPECT_FALSE(contains(cxx, "JUMP_SWITCH"));
+    EXPECT_TRUE(contains(cxx, "INVOKE(JUMP, jumpdest_map)"));
+}
+
+TEST(compiler_codegen, resolve_jump_bad_target)
+{
+    // PUSH1 3 PUSH1 5 JUMP; 5: JUMPDEST JUMP
+    // 3 is not a JUMPDEST: the jump is left to the jump destination map, which fails it.
+    const auto cxx = compile("6003600556""5b56", {});
+    EXPECT_FALSE(contains(cxx, "JUMP_TO("));
+    EXPECT_TRUE(contains(cxx, "INVOKE(JUMP, jumpdest_map)"));
+}
@@ -0,0 +1,157 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+/// Tests of the background compilations (compile_service.hpp). Without workers the jobs
+/// stay in the queue; with workers only contracts already in the cache are "compiled".
+
+#include "compiler_test_utils.hpp"
+#include <compiler/compile_service.hpp>
+#include <gtest/gtest.h>
+
+using namespace evmone;
+using evmone::test::make_temp_dir;
+namespace fs = std::filesystem;
+using namespace std::chrono_literals;
+
+namespace
+{
+/// PUSH1 n STOP: a distinct contract for every number.
+bytes make_code(uint8_t n)
+{
+    return {0x60, n, 0x00};
+}
+
+ContractKey make_key(uint8_t n)
+{
+    return {CacheKey{EVMC_SHANGHAI, make_code(n), {}}.code_hash, EVMC_SHANGHAI};
+}
+
+bool is_ready(const CompileService::Result& result)
+{
+    return result.wait_for(0s) == std::future_status::ready;
+}
+
+class compiler_compile_service : public testing::Test
+{
+protected:
+    fs::path dir = make_temp_dir("cache");
+    std::unique_ptr<CodeCache> cache = CodeCache::open(dir, 1 << 30);
+};
+}  // namespace
+
+TEST_F(compiler_compile_service, queue_full_drops_lowest_priority)
+{
+    ASSERT_NE(cache, nullptr);
+    CompileService service{*cache, {}, 0, 2};
+    const auto r1 = service.submit(make_key(1), make_code(1), 5);
+    const auto r2 = service.submit(make_key(2), make_code(2), 1);
+    EXPECT_EQ(service.num_pending(), 2);
+
+    const auto r3 = service.submit(make_key(3), make_code(3), 3);
+    EXPECT_EQ(service.num_pending(), 2);
+    ASSERT_TRUE(is_ready(r2));
+    EXPECT_EQ(r2.get().status, CompileStatus::dropped);
+    EXPECT_FALSE(is_ready(r1));
+    EXPECT_FALSE(is_ready(r3));
+
+    // A new compilation of the lowest priority is dropped at once.
+    const auto r4 = service.submit(make_key(4), make_code(4), 2);
+    ASSERT_TRUE(is_ready(r4));
+    EXPECT_EQ(r4.get().status, CompileStatus::dropped);
+    EXPECT_FALSE(service.raise_priority(make_key(4), 10));
+}
+
+TEST_F(compiler_compile_service, dropped_job_resubmitted)
+{
+    ASSERT_NE(cache, nullptr);
+    CompileService service{*cache, {}, 0, 1};
+    const auto r1 = service.submit(make_key(1), make_code(1), 1);
+    service.submit(make_key(2), make_code(2), 2);
+    ASSERT_TRUE(is_ready(r1));
+    EXPECT_EQ(r1.get().status, CompileStatus::dropped);
+
+    // The caller learns from raise_priority() that the job is gone and submits it again.
+    EXPECT_FALSE(service.raise_priority(make_key(1), 3));
+    const auto again = service.submit(make_key(1), make_code(1), 3);
+    EXPECT_FALSE(is_ready(again));
+    EXPECT_TRUE(service.raise_priority(make_key(1), 4));
+    EXPECT_EQ(service.num_pending(), 1);
+}
+
+TEST_F(compiler_compile_service, submit_pending_shares_job)
+{
+    ASSERT_NE(cache, nullptr);
+    CompileService service{*cache, {}, 0, 2};
+    const auto r1 = service.submit(make_key(1), make_code(1), 1);
+    service.submit(make_key(2), make_code(2), 2);
+
+    // Submitted again with a higher priority: no longer the lowest one.
+    const auto again = service.submit(make_key(1), make_code(1), 3);
+    EXPECT_EQ(service.num_pending(), 2);
+    const auto r3 = service.submit(make_key(3), make_code(3), 2);
+    ASSERT_TRUE(is_ready(r3));
+    EXPECT_EQ(r3.get().status, CompileStatus::dropped);
+    EXPECT_FALSE(is_ready(r1));
+    EXPECT_FALSE(is_ready(again));
+}
+
+TEST_F(compiler_compile_service, cancel_and_stop)
+{
+    ASSERT_NE(cache, nullptr);
+    CompileService::Result r1;
+    CompileService::Result r2;
+    {
+        CompileService service{*cache, {}, 0, 2};
+        r1 = service.submit(make_key(1), make_code(1), 1);
+        r2 = service.submit(make_key(2), make_code(2), 1);
+        EXPECT_TRUE(service.cancel(make_key(1)));
+        EXPECT_FALSE(service.cancel(make_key(1)));
+        ASSERT_TRUE(is_ready(r1));
+        EXPECT_EQ(r1.get().status, CompileStatus::cancelled);
+        EXPECT_FALSE(is_ready(r2));
+    }
+    // The pending compilations are dropped by the destructor.
+    ASSERT_TRUE(is_ready(r2));
+    EXPECT_EQ(r2.get().status, CompileStatus::dropped);
+}
+
+TEST_F(compiler_compile_service, compile_cached)
+{
+    ASSERT_NE(cache, nullptr);
+    const auto staging = make_temp_dir("staging");
+    fs::copy_file(EVMONE_COMPILER_TEST_OBJECT, staging / "a.so");
+    ASSERT_TRUE(cache->insert({EVMC_SHANGHAI, make_code(1), {}}, staging / "a.so"));
+
+    std::vector<std::pair<ContractKey, native_contract>> compiled;
+    const auto on_compiled = [&compiled](const ContractKey& key, native_contract fn) {
+        compiled.emplace_back(key, fn);
+    };
+    CompileService service{*cache, {}, 1, 2, on_compiled};
+    const auto [status, fn] = service.submit(make_key(1), make_code(1), 1).get();
+    EXPECT_EQ(status, CompileStatus::compiled);
+    EXPECT_NE(fn, nullptr);
+    ASSERT_EQ(compiled.size(), 1);
+    EXPECT_EQ(compiled[0].first, make_key(1));
+    EXPECT_EQ(compiled[0].second, fn);
+    EXPECT_FALSE(service.raise_priority(make_key(1), 2));
+}
+
+TEST_F(compiler_compile_service, build_failed)
+{
+    ASSERT_NE(cache, nullptr);
+    // Without the directory of the cache no object can be built.
+    fs::remove_all(dir);
+
+    CompileService service{*cache, {}, 1, 2};
+    EXPECT_EQ(service.submit(make_key(1), make_code(1), 1).get().status, CompileStatus::failed);
+    EXPECT_TRUE(service.failed(make_key(1)));
+    EXPECT_FALSE(service.failed(make_key(2)));
+
+    // A failed contract is not compiled again.
+    const auto again = service.submit(make_key(1), make_code(1), 2);
+    ASSERT_TRUE(is_ready(again));
+    EXPECT_EQ(again.get().status, CompileStatus::failed);
+    EXPECT_FALSE(service.raise_priority(make_key(1), 3));
+    EXPECT_EQ(service.num_pending(), 0);
+}
@@ -0,0 +1,149 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+/// Tests of the division kernels of the compiler runtime (aot_intx.hpp) used by
+/// DIV, MOD, SDIV, SMOD, ADDMOD and MULMOD, against intx.
+
+#include <compiler/aot_intx.hpp>
+#include <gtest/gtest.h>
+#include <intx/intx.hpp>
+#include <random>
+
+namespace aot = evmone::intx;
+using aot_uint256 = evmone::uint256;
+
+namespace
+{
+aot_uint256 from_words(uint64_t w0, uint64_t w1, uint64_t w2, uint64_t w3)
+{
+    return aot::from_words({w0, w1, w2, w3});
+}
+
+intx::uint256 to_intx(const aot_uint256& v)
+{
+    const auto w = aot::to_words(v);
+    return {w[0], w[1], w[2], w[3]};
+}
+
+/// Returns a random value of at most the given number of bits. Unlike the benchmark operands,
+/// the top bit is not forced so the divisors take all the normalization shifts.
+aot_uint256 random_value(std::mt19937_64& gen, unsigned bits)
+{
+    if (bits == 0)
+        return 0;
+    const auto v = from_words(gen(), gen(), gen(), gen());
+    return v >> (256 - bits);
+}
+
+/// Checks DIV, MOD, SDIV and SMOD of x and y != 0.
+void check_div(const aot_uint256& x, const aot_uint256& y)
+{
+    const auto ix = to_intx(x);
+    const auto iy = to_intx(y);
+
+    const auto u = aot::udivrem(x, y);
+    const auto iu = intx::udivrem(ix, iy);
+    EXPECT_EQ(to_intx(u.quot), iu.quot) << intx::hex(ix) << " / " << intx::hex(iy);
+    EXPECT_EQ(to_intx(u.rem), iu.rem) << intx::hex(ix) << " % " << intx::hex(iy);
+
+    const auto s = aot::sdivrem(x, y);
+    const auto is = intx::sdivrem(ix, iy);
+    EXPECT_EQ(to_intx(s.quot), is.quot) << intx::hex(ix) << " sdiv " << intx::hex(iy);
+    EXPECT_EQ(to_intx(s.rem), is.rem) << intx::hex(ix) << " smod " << intx::hex(iy);
+}
+
+/// Checks ADDMOD and MULMOD of x, y and m != 0.
+void check_mod(const aot_uint256& x, const aot_uint256& y, const aot_uint256& m)
+{
+    const auto ix = to_intx(x);
+    const auto iy = to_intx(y);
+    const auto im = to_intx(m);
+    EXPECT_EQ(to_intx(aot::addmod(x, y, m)), intx::addmod(ix, iy, im))
+        << intx::hex(ix) << " + " << intx::hex(iy) << " mod " << intx::hex(im);
+    EXPECT_EQ(to_intx(aot::mulmod(x, y, m)), intx::mulmod(ix, iy, im))
+        << intx::hex(ix) << " * " << intx::hex(iy) << " mod " << intx::hex(im);
+}
+
+/// Operands of the Knuth division (divisors of 3 and 4 words) with the normalization shifts
+/// 0, 1 and 62 whose quotient estimate is one too big: the divisor is added back.
+const std::pair<aot_uint256, aot_uint256> add_back_cases[] = {
+    {from_words(0xa7d3fc773d7c6bb5, 1, 0x8000000000000000, 0xfffffffffffffffe),
+        from_words(0x7fffffffffffffff, 0x8000000000000000, 0xfffffffffffffffe, 0)},
+    {from_words(1, 2, 0x8000000000000000, 0x8000000000000001),
+        from_words(0xfffffffffffffffe, 0xfffffffffffffffe, 0x8000000000000000, 0x8000000000000001)},
+    {from_words(0x8000000000000000, 0xfffffffffffffffe, 0xfffffffffffffffe, 0),
+        from_words(0xfffffffffffffffe, 0x7fffffffffffffff, 2, 0)},
+    {from_words(0xfffffffffffffffe, 0xd015f7f521645547, 0x7fffffffffffffff, 0x529f94412a38eae3),
+        from_words(0xfffffffffffffffe, 0xffffffffffffffff, 0x7fffffffffffffff, 0)},
+};
+
+/// Operands of the Knuth division whose top numerator words equal the top divisor words:
+/// the 3-by-2 estimate of the quotient word would overflow.
+const std::pair<aot_uint256, aot_uint256> estimate_overflow_cases[] = {
+    {from_words(0xe0ad813c166a15d6, 0x3be790574de27eeb, 0x8000000000000001, 0xfffffffffffffffe),
+        from_words(0xe55bb45525457cd5, 0x8000000000000001, 0xfffffffffffffffe, 0)},
+    {from_words(0, 0x8000000000000000, 1, 0xfffffffffffffffe),
+        from_words(0xfffffffffffffffe, 1, 0xfffffffffffffffe, 0)},
+};
+}  // namespace
+
+TEST(compiler_intx, div_random_widths)
+{
+    std::mt19937_64 gen{1};
+    for (int i = 0; i < 20000; ++i)
+    {
+        const auto x = random_value(gen, unsigned(gen() % 257));
+        const auto y = random_value(gen, 1 + unsigned(gen() % 256));
+        if (y != 0)
+            check_div(x, y);
+    }
+}
+
+TEST(compiler_intx, mod_random_widths)
+{
+    std::mt19937_64 gen{2};
+    for (int i = 0; i < 20000; ++i)
+    {
+        const auto x = random_value(gen, unsigned(gen() % 257));
+        const auto y = random_value(gen, unsigned(gen() % 257));
+        const auto m = random_value(gen, 1 + unsigned(gen() % 256));
+        if (m != 0)
+            check_mod(x, y, m);
+    }
+}
+
+TEST(compiler_intx, div_add_back)
+{
+    for (const auto& [x, y] : add_back_cases)
+        check_div(x, y);
+}
+
+TEST(compiler_intx, div_estimate_overflow)
+{
+    for (const auto& [x, y] : estimate_overflow_cases)
+        check_div(x, y);
+}
+
+TEST(compiler_intx, edge_values)
+{
+    const aot_uint256 min_signed = aot_uint256{1} << 255;
+    const aot_uint256 values[] = {0, 1, 2, ~aot_uint256{0}, ~aot_uint256{0} - 1, min_signed,
+        min_signed - 1, min_signed + 1, aot_uint256{1} << 64, (aot_uint256{1} << 64) - 1,
+        aot_uint256{1} << 128, (aot_uint256{1} << 128) - 1, aot_uint256{1} << 192,
+        (aot_uint256{1} << 192) - 1};
+    for (const auto& x : values)
+    {
+        for (const auto& y : values)
+        {
+            if (y == 0)
+                continue;
+            check_div(x, y);
+            for (const auto& m : values)
+            {
+                if (m != 0)
+                    check_mod(x, y, m);
+            }
+        }
+    }
+}
@@ -0,0 +1,124 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+/// Tests of the profiler of the interpreted contracts (profiler.hpp).
+
+#include <compiler/profiler.hpp>
+#include <gtest/gtest.h>
+
+using namespace evmone;
+
+namespace
+{
+evmc::bytes32 make_hash(uint8_t n)
+{
+    evmc::bytes32 hash{};
+    hash.bytes[31] = n;
+    return hash;
+}
+}  // namespace
+
+TEST(compiler_profiler, promote_once)
+{
+    HotnessProfiler profiler;
+    profiler.thresholds.num_calls = 3;
+    const auto hash = make_hash(1);
+    EXPECT_FALSE(profiler.promote(*profiler.record(hash, EVMC_SHANGHAI, 0)));
+    EXPECT_FALSE(profiler.promote(*profiler.record(hash, EVMC_SHANGHAI, 0)));
+    const auto counters = profiler.record(hash, EVMC_SHANGHAI, 0);
+    EXPECT_TRUE(profiler.promote(*counters));
+    EXPECT_TRUE(counters->hot);
+    EXPECT_FALSE(profiler.promote(*counters));
+    EXPECT_FALSE(profiler.promote(*profiler.record(hash, EVMC_SHANGHAI, 0)));
+
+    // Another revision is another contract.
+    EXPECT_FALSE(profiler.promote(*profiler.record(hash, EVMC_PARIS, 0)));
+    EXPECT_EQ(profiler.size(), 2);
+}
+
+TEST(compiler_profiler, promote_by_gas)
+{
+    HotnessProfiler profiler;
+    profiler.thresholds.gas_used = 100;
+    const auto hash = make_hash(1);
+    EXPECT_FALSE(profiler.promote(*profiler.record(hash, EVMC_SHANGHAI, 60)));
+    EXPECT_TRUE(profiler.promote(*profiler.record(hash, EVMC_SHANGHAI, 50)));
+}
+
+TEST(compiler_profiler, demote)
+{
+    HotnessProfiler profiler;
+    profiler.thresholds.num_calls = 2;
+    const auto hash = make_hash(1);
+    profiler.record(hash, EVMC_SHANGHAI, 10);
+    const auto counters = profiler.record(hash, EVMC_SHANGHAI, 10);
+    ASSERT_TRUE(profiler.promote(*counters));
+
+    // E.g. the compilation has been dropped: the contract is profiled again from scratch.
+    HotnessProfiler::demote(*counters);
+    EXPECT_FALSE(counters->hot);
+    EXPECT_EQ(counters->num_calls, 0);
+    EXPECT_EQ(counters->gas_used, 0);
+    EXPECT_FALSE(profiler.promote(*profiler.record(hash, EVMC_SHANGHAI, 0)));
+    EXPECT_TRUE(profiler.promote(*profiler.record(hash, EVMC_SHANGHAI, 0)));
+}
+
+TEST(compiler_profiler, disabled)
+{
+    HotnessProfiler profiler;
+    EXPECT_FALSE(profiler.thresholds.enabled());
+    for (int i = 0; i < 10; ++i)
+        EXPECT_FALSE(profiler.promote(*profiler.record(make_hash(1), EVMC_SHANGHAI, 1000)));
+}
+
+TEST(compiler_profiler, remove)
+{
+    HotnessProfiler profiler;
+    const auto hash = make_hash(1);
+    const auto counters = profiler.record(hash, EVMC_SHANGHAI, 10);
+    EXPECT_EQ(profiler.find(hash, EVMC_SHANGHAI), counters);
+
+    profiler.remove(hash, EVMC_SHANGHAI);
+    EXPECT_EQ(profiler.size(), 0);
+    EXPECT_EQ(profiler.find(hash, EVMC_SHANGHAI), nullptr);
+    EXPECT_EQ(counters->num_calls, 1);  // Still owned by the caller.
+
+    // Profiled from scratch when executed again.
+    EXPECT_EQ(profiler.record(hash, EVMC_SHANGHAI, 10)->num_calls, 1);
+}
+
+TEST(compiler_profiler, decay)
+{
+    HotnessProfiler profiler;
+    profiler.max_contracts = 4;
+    for (uint8_t i = 1; i <= 3; ++i)
+        profiler.record(make_hash(i), EVMC_SHANGHAI, 10);
+    for (int i = 0; i < 4; ++i)
+        profiler.record(make_hash(4), EVMC_SHANGHAI, 10);
+    EXPECT_EQ(profiler.size(), 4);
+
+    // The contracts executed once are forgotten, the counters of the others are halved.
+    profiler.record(make_hash(5), EVMC_SHANGHAI, 10);
+    EXPECT_EQ(profiler.size(), 2);
+    EXPECT_EQ(profiler.find(make_hash(1), EVMC_SHANGHAI), nullptr);
+    const auto counters = profiler.find(make_hash(4), EVMC_SHANGHAI);
+    ASSERT_NE(counters, nullptr);
+    EXPECT_EQ(counters->num_calls, 2);
+    EXPECT_EQ(counters->gas_used, 20);
+}
+
+TEST(compiler_profiler, decay_keeps_hot)
+{
+    HotnessProfiler profiler;
+    profiler.thresholds.num_calls = 1;
+    profiler.max_contracts = 2;
+    for (uint8_t i = 1; i <= 2; ++i)
+        ASSERT_TRUE(profiler.promote(*profiler.record(make_hash(i), EVMC_SHANGHAI, 0)));
+
+    // The hot contracts are being compiled and are not forgotten: the decay gives up.
+    profiler.record(make_hash(3), EVMC_SHANGHAI, 0);
+    EXPECT_EQ(profiler.size(), 3);
+    EXPECT_NE(profiler.find(make_hash(1), EVMC_SHANGHAI), nullptr);
+    EXPECT_NE(profiler.find(make_hash(2), EVMC_SHANGHAI), nullptr);
+}
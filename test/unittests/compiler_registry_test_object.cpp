@@ -0,0 +1,39 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+/// A stand-in for a library of compiled contracts loaded by the AotVM and ContractRegistry
+/// tests: the table registers one contract, of the code hash 0xaa00..00 in Shanghai, whose
+/// native code returns the address of its ExecutionState as the output.
+
+#include <compiler/registry.hpp>
+#include <cstring>
+#include <iterator>
+
+namespace
+{
+void release_output(const evmc_result* result) noexcept
+{
+    delete[] result->output_data;
+}
+
+evmc_result return_state_address(evmone::ExecutionState& state) noexcept
+{
+    const auto address = reinterpret_cast<uintptr_t>(&state);
+    auto* const output = new uint8_t[sizeof(address)];
+    std::memcpy(output, &address, sizeof(address));
+
+    evmc_result result{};
+    result.status_code = EVMC_SUCCESS;
+    result.output_data = output;
+    result.output_size = sizeof(address);
+    result.release = release_output;
+    return result;
+}
+}  // namespace
+
+extern "C" EVMC_EXPORT const evmone::CompiledContract evmone_aot_contracts[] = {
+    {{0xaa}, EVMC_SHANGHAI, return_state_address},
+};
+
+extern "C" EVMC_EXPORT const size_t evmone_aot_num_contracts = std::size(evmone_aot_contracts);
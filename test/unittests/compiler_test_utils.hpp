@@ -0,0 +1,36 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2019 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace evmone::test
+{
+/// Returns a new empty temporary directory of the running test, e.g.
+/// evmone_compiler_cache.insert_and_find.<pid>.staging for the name "staging".
+///
+/// The test name and the process id keep the directories of the tests run in parallel
+/// (e.g. by ctest -j) apart.
+inline std::filesystem::path make_temp_dir(std::string_view name)
+{
+    const auto* const info = testing::UnitTest::GetInstance()->current_test_info();
+    auto dir_name = std::string{"evmone_"} + info->test_suite_name() + '.' + info->name() + '.' +
+                    std::to_string(::getpid()) + '.' + std::string{name};
+    // The parameterized tests are named suite/test/param.
+    for (auto& c : dir_name)
+    {
+        if (c == '/')
+            c = '_';
+    }
+
+    const auto dir = std::filesystem::temp_directory_path() / dir_name;
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    return dir;
+}
+}  // namespace evmone::test
@@ -4,6 +4,7 @@
 
 #include <evmone/advanced_analysis.hpp>
 #include <evmone/execution_state.hpp>
+#include <evmone/execution_state_pool.hpp>
 #include <gtest/gtest.h>
 #include <type_traits>
 
@@ -172,3 +173,61 @@ TEST(execution_state, memory_view)
     EXPECT_EQ(view[1], 0x00);
     EXPECT_EQ(view[2], 0xc2);
 }
+
+TEST(execution_state, pool_reuse_by_depth)
+{
+    evmone::ExecutionStatePool pool;
+    const evmc_host_interface host_interface{};
+    evmc_message msg0{};
+    evmc_message msg1{};
+    msg1.depth = 1;
+
+    evmone::ExecutionState* state0 = nullptr;
+    {
+        const auto st0 = pool.acquire(msg0, EVMC_SHANGHAI, host_interface, nullptr, {}, {});
+        const auto st1 = pool.acquire(msg1, EVMC_SHANGHAI, host_interface, nullptr, {}, {});
+        EXPECT_NE(st0.get(), st1.get());
+        st0->memory.grow(64 * 1024);
+        st0->status = EVMC_REVERT;
+        state0 = st0.get();
+    }
+    EXPECT_EQ(pool.size(), 2);
+    EXPECT_EQ(pool.max_depth(), 1);
+    EXPECT_EQ(pool.num_allocations(), 2);
+    EXPECT_EQ(pool.memory_capacity(), 64 * 1024 + 4 * 1024);
+
+    const auto st = pool.acquire(msg0, EVMC_CANCUN, host_interface, nullptr, {}, {});
+    EXPECT_EQ(st.get(), state0);
+    EXPECT_EQ(st->rev, EVMC_CANCUN);
+    EXPECT_EQ(st->status, EVMC_SUCCESS);
+    EXPECT_EQ(st->memory.size(), 0);
+    EXPECT_EQ(st->memory.capacity(), 64 * 1024);  // The grown capacity is kept.
+    EXPECT_EQ(pool.num_allocations(), 2);
+}
+
+TEST(execution_state, pool_reentrant_depth)
+{
+    evmone::ExecutionStatePool pool;
+    const evmc_host_interface host_interface{};
+    const evmc_message msg{};
+
+    const auto st = pool.acquire(msg, EVMC_SHANGHAI, host_interface, nullptr, {}, {});
+    {
+        const auto reentrant = pool.acquire(msg, EVMC_SHANGHAI, host_interface, nullptr, {}, {});
+        EXPECT_NE(reentrant.get(), st.get());
+    }
+    EXPECT_EQ(pool.size(), 1);
+    EXPECT_EQ(pool.num_allocations(), 2);
+}
+
+TEST(execution_state, pool_large_memory_not_retained)
+{
+    evmone::ExecutionStatePool pool;
+    const evmc_host_interface host_interface{};
+    const evmc_message msg{};
+    {
+        const auto st = pool.acquire(msg, EVMC_SHANGHAI, host_interface, nullptr, {}, {});
+        st->memory.grow(evmone::ExecutionStatePool::max_retained_memory + 1024);
+    }
+    EXPECT_EQ(pool.size(), 0);
+}
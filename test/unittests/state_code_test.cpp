@@ -0,0 +1,56 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2023 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <test/state/state.hpp>
+#include <test/utils/utils.hpp>
+
+using namespace evmone;
+using namespace evmone::state;
+
+TEST(state_code, empty)
+{
+    const Code code;
+    EXPECT_TRUE(code.empty());
+    EXPECT_EQ(code.size(), 0);
+    EXPECT_EQ(code.hash(), keccak256({}));
+    EXPECT_TRUE(Code{bytes{}}.empty());
+}
+
+TEST(state_code, hash)
+{
+    const auto bytecode = "6001600055"_hex;
+    const Code code = bytecode;
+    EXPECT_EQ(code, bytecode);
+    EXPECT_EQ(code.size(), bytecode.size());
+    EXPECT_EQ(code.hash(), keccak256(bytecode));
+}
+
+TEST(state_code, deduplicated)
+{
+    const auto bytecode = "6002600055"_hex;
+    const Code a = bytecode;
+    const Code b = bytes_view{bytecode};
+    EXPECT_EQ(a.data(), b.data());
+    EXPECT_NE(a.data(), Code{"6003600055"_hex}.data());
+
+    State state;
+    state.insert(0x01_address, {.code = bytecode});
+    state.insert(0x02_address, {.code = bytecode});
+    EXPECT_EQ(state.get(0x01_address).code.data(), state.get(0x02_address).code.data());
+    EXPECT_EQ(state.get(0x01_address).code.data(), a.data());
+}
+
+TEST(state_code, outlives_account)
+{
+    const auto bytecode = "6004600055"_hex;
+    Code code;
+    {
+        State state;
+        state.insert(0x01_address, {.code = bytecode});
+        code = state.get(0x01_address).code;
+    }
+    EXPECT_EQ(code, bytecode);
+    EXPECT_EQ(code.hash(), keccak256(bytecode));
+}
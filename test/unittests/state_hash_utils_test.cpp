@@ -0,0 +1,50 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2023 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <test/state/hash_utils.hpp>
+
+using namespace evmone;
+using namespace evmc::literals;
+
+TEST(state_hash_utils, keccak256_batch_empty)
+{
+    keccak256_batch({}, {});
+
+    const bytes_view inputs[]{{}};
+    hash256 hashes[1];
+    keccak256_batch(inputs, hashes);
+    EXPECT_EQ(
+        hashes[0], 0xc5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470_bytes32);
+}
+
+TEST(state_hash_utils, keccak256_batch)
+{
+    // The lengths around the block size (136 bytes), so the inputs absorb different number of
+    // blocks and finish at different times.
+    std::vector<bytes> data;
+    for (const size_t len : {0, 1, 31, 32, 33, 64, 135, 136, 137, 271, 272, 300, 1000})
+    {
+        bytes d(len, 0);
+        for (size_t i = 0; i < len; ++i)
+            d[i] = static_cast<uint8_t>(i * 7 + len);
+        data.emplace_back(std::move(d));
+    }
+
+    // All the batch sizes and the offsets of the inputs in the batch.
+    for (size_t n = 1; n <= data.size(); ++n)
+    {
+        for (size_t offset = 0; offset < data.size(); ++offset)
+        {
+            std::vector<bytes_view> inputs;
+            for (size_t i = 0; i < n; ++i)
+                inputs.emplace_back(data[(offset + i) % data.size()]);
+            std::vector<hash256> hashes(n);
+            keccak256_batch(inputs, hashes);
+
+            for (size_t i = 0; i < n; ++i)
+                EXPECT_EQ(hashes[i], keccak256(inputs[i])) << "n=" << n << " i=" << i;
+        }
+    }
+}
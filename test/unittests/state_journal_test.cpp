@@ -0,0 +1,71 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2023 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <evmc/evmc.hpp>
+#include <gtest/gtest.h>
+#include <test/state/state.hpp>
+
+using namespace evmc::literals;
+using namespace evmone::state;
+
+TEST(state_journal, rollback_account_changes)
+{
+    State state;
+    auto& acc = state.insert(0x01_address, {.nonce = 1, .balance = 10, .code = {0x00}});
+
+    const auto checkpoint = state.checkpoint();
+    state.journal_nonce_change(0x01_address, acc.nonce);
+    acc.nonce = 2;
+    state.journal_balance_change(0x01_address, acc.balance);
+    acc.balance = 20;
+    state.journal_code_change(0x01_address, acc.code);
+    acc.code = {0x01, 0x02};
+    state.journal_destruct(0x01_address);
+    acc.destructed = true;
+    state.journal_access_account(0x01_address);
+    acc.access_status = EVMC_ACCESS_WARM;
+    state.touch(0x01_address);
+    state.touch(0x02_address).balance = 1;
+    EXPECT_EQ(state.get_accounts().size(), 2);
+
+    state.rollback(checkpoint);
+    EXPECT_EQ(state.checkpoint(), checkpoint);
+    EXPECT_EQ(state.get_accounts().size(), 1);
+    EXPECT_EQ(acc.nonce, 1);
+    EXPECT_EQ(acc.balance, 10);
+    EXPECT_EQ(acc.code, bytes{0x00});
+    EXPECT_FALSE(acc.destructed);
+    EXPECT_FALSE(acc.erasable);
+    EXPECT_EQ(acc.access_status, EVMC_ACCESS_COLD);
+}
+
+TEST(state_journal, rollback_storage_changes)
+{
+    State state;
+    auto& acc =
+        state.insert(0x01_address, {.storage = {{0x01_bytes32, {.current = 0x0a_bytes32}}}});
+
+    const auto outer = state.checkpoint();
+    state.update_storage(0x01_address, 0x01_bytes32).current = 0x0b_bytes32;
+    state.update_transient_storage(0x01_address, 0x01_bytes32) = 0x01_bytes32;
+
+    const auto inner = state.checkpoint();
+    state.update_storage(0x01_address, 0x01_bytes32).current = 0x0c_bytes32;
+    state.update_storage(0x01_address, 0x02_bytes32).access_status = EVMC_ACCESS_WARM;
+    state.update_transient_storage(0x01_address, 0x01_bytes32) = 0x02_bytes32;
+
+    state.rollback(inner);
+    EXPECT_EQ(acc.storage.size(), 1);
+    EXPECT_EQ(acc.storage[0x01_bytes32].current, 0x0b_bytes32);
+    EXPECT_EQ(acc.transient_storage[0x01_bytes32], 0x01_bytes32);
+
+    state.rollback(outer);
+    EXPECT_EQ(acc.storage[0x01_bytes32].current, 0x0a_bytes32);
+    EXPECT_TRUE(acc.transient_storage.empty());
+
+    state.update_storage(0x01_address, 0x01_bytes32).current = 0x0d_bytes32;
+    state.commit();
+    EXPECT_EQ(state.checkpoint(), 0);
+    EXPECT_EQ(acc.storage[0x01_bytes32].current, 0x0d_bytes32);
+}
@@ -64,6 +64,95 @@ TEST(state_mpt_hash, deleted_storage)
         0x4e7338c16731491e0fb5d1623f5265c17699c970c816bab71d4d717f6071414d_bytes32);
 }
 
+TEST(state_mpt_hash, state_root_hash)
+{
+    State state;
+    EXPECT_EQ(state.root_hash(), emptyMPTHash);
+    state.insert(0x01_address, {.balance = 1});
+    state.insert(0x02_address, {.nonce = 1, .storage = {{0x01_bytes32, {0xfe_bytes32}}}});
+    EXPECT_EQ(state.root_hash(), mpt_hash(state.get_accounts()));
+
+    auto& acc1 = state.get(0x01_address);
+    state.journal_balance_change(0x01_address, acc1.balance);
+    acc1.balance = 2;
+    state.update_storage(0x02_address, 0x01_bytes32).current = {};
+    state.update_storage(0x02_address, 0x02_bytes32).current = 0xfd_bytes32;
+    state.get_or_insert(0x03_address).nonce = 1;
+    state.commit();
+    EXPECT_EQ(state.root_hash(), mpt_hash(state.get_accounts()));
+
+    // Accounts erased and inserted again, with other storage.
+    state.journal_destruct(0x02_address);
+    state.get_accounts().erase(0x02_address);
+    state.commit();
+    EXPECT_EQ(state.root_hash(), mpt_hash(state.get_accounts()));
+    state.insert(0x02_address, {.storage = {{0x03_bytes32, {0xfc_bytes32}}}});
+    EXPECT_EQ(state.root_hash(), mpt_hash(state.get_accounts()));
+
+    // The rolled back changes.
+    const auto checkpoint = state.checkpoint();
+    state.update_storage(0x02_address, 0x03_bytes32).current = {};
+    state.rollback(checkpoint);
+    state.commit();
+    EXPECT_EQ(state.root_hash(), mpt_hash(state.get_accounts()));
+
+    const auto copy = state;
+    EXPECT_EQ(State{copy}.root_hash(), state.root_hash());
+}
+
+TEST(state_mpt_hash, state_root_hash_destruct_and_recreate)
+{
+    State state;
+    state.insert(0x01_address,
+        {.nonce = 1, .storage = {{0x01_bytes32, {0xfe_bytes32}}, {0x02_bytes32, {0xfd_bytes32}}}});
+    EXPECT_EQ(state.root_hash(), mpt_hash(state.get_accounts()));
+
+    // Transaction 1: the account selfdestructs.
+    state.journal_destruct(0x01_address);
+    state.get(0x01_address).destructed = true;
+    std::erase_if(state.get_accounts(), [](const auto& p) { return p.second.destructed; });
+    state.commit();
+
+    // Transaction 2 (same block): the account is created again at the same address (CREATE2),
+    // writing another slot. The old slots must not stay in its storage root.
+    state.get_or_insert(0x01_address).nonce = 1;
+    state.update_storage(0x01_address, 0x03_bytes32).current = 0xfc_bytes32;
+    state.commit();
+    EXPECT_EQ(state.get(0x01_address).storage.size(), 1);
+    EXPECT_EQ(state.root_hash(), mpt_hash(state.get_accounts()));
+
+    // Destructed and recreated within the same transaction.
+    state.journal_destruct(0x01_address);
+    state.get_accounts().erase(0x01_address);
+    state.get_or_insert(0x01_address).nonce = 2;
+    state.update_storage(0x01_address, 0x04_bytes32).current = 0xfb_bytes32;
+    state.commit();
+    EXPECT_EQ(state.root_hash(), mpt_hash(state.get_accounts()));
+}
+
+TEST(state_mpt_hash, parallel)
+{
+    State state;
+    for (uint64_t i = 0; i < 1000; ++i)
+    {
+        auto& acc = state.insert(address{i}, {.nonce = i});
+        for (uint64_t j = 0; j < i % 10; ++j)
+            acc.storage[bytes32{j}] = {bytes32{i}};
+    }
+    const auto expected = mpt_hash(state.get_accounts());
+    EXPECT_EQ(mpt_hash(state.get_accounts(), 8), expected);
+    EXPECT_EQ(state.root_hash(8), expected);
+
+    for (uint64_t i = 0; i < 1000; i += 3)
+    {
+        state.update_storage(address{i}, bytes32{1}).current = bytes32{i + 1};
+        state.journal_nonce_change(address{i}, i);
+        state.get(address{i}).nonce = i + 1;
+    }
+    state.commit();
+    EXPECT_EQ(state.root_hash(8), mpt_hash(state.get_accounts()));
+}
+
 TEST(state_mpt_hash, one_transactions)
 {
     // https://sepolia.etherscan.io/tx/0xd4070618ed3026722ae5dbacc95e70714327d65abce292bba9de38201895cdff
@@ -155,6 +155,25 @@ TEST(state_mpt, extension_node_example2)
     EXPECT_EQ(hex(trie.hash()), "ac28c08fa3ff1d0d2cc9a6423abb7af3f4dcc37aa2210727e7d3009a9b4a34e8");
 }
 
+TEST(state_mpt, update)
+{
+    MPT trie;
+    trie.insert("01"_hex, to_bytes("a"));
+    trie.insert("02"_hex, to_bytes("b"));
+    const auto hash = trie.hash();
+
+    trie.insert("01"_hex, to_bytes("c"));
+    EXPECT_NE(trie.hash(), hash);
+    trie.insert("01"_hex, to_bytes("a"));
+    EXPECT_EQ(trie.hash(), hash);
+
+    trie.erase("03"_hex);  // Not in the trie.
+    EXPECT_EQ(trie.hash(), hash);
+    trie.erase("01"_hex);
+    trie.erase("02"_hex);
+    EXPECT_EQ(trie.hash(), emptyMPTHash);
+}
+
 TEST(state_mpt, trie_topologies)
 {
     struct KVH
@@ -353,6 +372,21 @@ TEST(state_mpt, trie_topologies)
             }
         }
 
+        // Erase in reverse order and check hash at every step.
+        {
+            MPT trie;
+            for (const auto& kv : test)
+                trie.insert(from_hex(kv.key_hex).value(), to_bytes(kv.value));
+            EXPECT_EQ(hex(trie.hash()), test.back().hash_hex);
+            for (size_t i = test.size() - 1; i != 0; --i)
+            {
+                trie.erase(from_hex(test[i].key_hex).value());
+                EXPECT_EQ(hex(trie.hash()), test[i - 1].hash_hex);
+            }
+            trie.erase(from_hex(test[0].key_hex).value());
+            EXPECT_EQ(trie.hash(), emptyMPTHash);
+        }
+
         // Check if all insert order permutations give the same final hash.
         std::vector<size_t> order(test.size());
         std::iota(order.begin(), order.end(), size_t{0});
@@ -366,3 +400,62 @@ TEST(state_mpt, trie_topologies)
         }
     }
 }
+
+TEST(state_mpt, reuse_erased_nodes)
+{
+    // The slots of the erased nodes are reused by the following insertions.
+    std::vector<hash256> keys;
+    for (uint64_t i = 0; i < 1000; ++i)
+        keys.emplace_back(keccak256(bytes32{i}));
+
+    MPT trie;
+    for (size_t i = 0; i < keys.size(); ++i)
+        trie.insert(keys[i], bytes(40, static_cast<uint8_t>(i)));
+    (void)trie.hash();
+    for (size_t i = 0; i < keys.size(); i += 2)
+        trie.erase(keys[i]);
+    for (size_t i = 1; i < keys.size(); i += 4)
+        trie.insert(keys[i], to_bytes("updated"));
+
+    MPT expected;
+    for (size_t i = 1; i < keys.size(); i += 2)
+    {
+        expected.insert(
+            keys[i], i % 4 == 1 ? to_bytes("updated") : bytes(40, static_cast<uint8_t>(i)));
+    }
+    const auto hash = expected.hash();
+    EXPECT_EQ(trie.hash(), hash);
+
+    MPT moved{std::move(trie)};
+    EXPECT_EQ(moved.hash(), hash);
+    moved = std::move(expected);
+    EXPECT_EQ(moved.hash(), hash);
+    EXPECT_EQ(expected.hash(), emptyMPTHash);  // NOLINT(bugprone-use-after-move)
+}
+
+TEST(state_mpt, hash_in_parallel)
+{
+    std::vector<hash256> keys;
+    for (uint64_t i = 0; i < 1000; ++i)
+        keys.emplace_back(keccak256(bytes32{i}));
+
+    MPT trie;
+    MPT expected;
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        trie.insert(keys[i], bytes(40, static_cast<uint8_t>(i)));
+        expected.insert(keys[i], bytes(40, static_cast<uint8_t>(i)));
+    }
+    EXPECT_EQ(trie.hash(8), expected.hash());
+
+    // Too few modifications to be rehashed by more than one thread, and then enough.
+    for (const size_t step : {size_t{300}, size_t{3}})
+    {
+        for (size_t i = 0; i < keys.size(); i += step)
+        {
+            trie.insert(keys[i], to_bytes("updated"));
+            expected.insert(keys[i], to_bytes("updated"));
+        }
+        EXPECT_EQ(trie.hash(8), expected.hash());
+    }
+}
@@ -0,0 +1,217 @@
+// evmone: Fast Ethereum Virtual Machine implementation
+// Copyright 2024 The evmone Authors.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <test/state/precompiles_cache.hpp>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+using namespace evmone::state;
+
+namespace
+{
+evmc::Result success_result(bytes_view output)
+{
+    return evmc::Result{EVMC_SUCCESS, 0, 0, output.data(), output.size()};
+}
+
+bytes_view output_of(const evmc::Result& r) noexcept
+{
+    return {r.output_data, r.output_size};
+}
+}  // namespace
+
+TEST(state_precompiles_cache, find_inserted)
+{
+    Cache cache{Cache::default_max_size};
+    const bytes input{0x01, 0x02};
+    const bytes output{0xaa, 0xbb, 0xcc};
+    EXPECT_FALSE(cache.find(PrecompileId::sha256, input, 0).has_value());
+
+    cache.insert(PrecompileId::sha256, input, success_result(output));
+    const auto r = cache.find(PrecompileId::sha256, input, 7);
+    ASSERT_TRUE(r.has_value());
+    EXPECT_EQ(r->status_code, EVMC_SUCCESS);
+    EXPECT_EQ(r->gas_left, 7);
+    EXPECT_EQ(output_of(*r), output);
+
+    // The entries are separate for each precompile.
+    EXPECT_FALSE(cache.find(PrecompileId::ripemd160, input, 0).has_value());
+    EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(state_precompiles_cache, failure)
+{
+    Cache cache{Cache::default_max_size};
+    const bytes input{0x01};
+    cache.insert(PrecompileId::ecrecover, input, evmc::Result{EVMC_PRECOMPILE_FAILURE});
+    const auto r = cache.find(PrecompileId::ecrecover, input, 0);
+    ASSERT_TRUE(r.has_value());
+    EXPECT_EQ(r->status_code, EVMC_PRECOMPILE_FAILURE);
+}
+
+TEST(state_precompiles_cache, identity_not_cached)
+{
+    Cache cache{Cache::default_max_size};
+    const bytes input{0x01};
+    cache.insert(PrecompileId::identity, input, success_result(input));
+    EXPECT_FALSE(cache.find(PrecompileId::identity, input, 0).has_value());
+    EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(state_precompiles_cache, evict_least_recently_used)
+{
+    // The budget of a few entries per shard.
+    Cache cache{16 * 1024};
+    const bytes output(64, 0xff);
+    const bytes hot_input{0x00};
+    cache.insert(PrecompileId::sha256, hot_input, success_result(output));
+
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        const bytes input{0x01, static_cast<uint8_t>(i), static_cast<uint8_t>(i >> 8)};
+        cache.insert(PrecompileId::sha256, input, success_result(output));
+        EXPECT_TRUE(cache.find(PrecompileId::sha256, hot_input, 0).has_value());
+    }
+    EXPECT_LT(cache.size(), 200);
+}
+
+TEST(state_precompiles_cache, save_and_load)
+{
+    const auto path =
+        (std::filesystem::temp_directory_path() / "evmone_precompiles_cache_test.bin").string();
+    const bytes output{0x11, 0x22};
+    {
+        Cache cache{Cache::default_max_size};
+        for (uint8_t i = 0; i < 100; ++i)
+            cache.insert(PrecompileId::sha256, bytes{i}, success_result(output));
+        cache.insert(PrecompileId::ecpairing, bytes{0x01}, evmc::Result{EVMC_PRECOMPILE_FAILURE});
+        ASSERT_TRUE(cache.save(path));
+    }
+
+    Cache cache{Cache::default_max_size};
+    ASSERT_TRUE(cache.load(path));
+    EXPECT_EQ(cache.size(), 101);
+    for (uint8_t i = 0; i < 100; ++i)
+    {
+        const auto r = cache.find(PrecompileId::sha256, bytes{i}, 0);
+        ASSERT_TRUE(r.has_value());
+        EXPECT_EQ(output_of(*r), output);
+    }
+    const auto r = cache.find(PrecompileId::ecpairing, bytes{0x01}, 0);
+    ASSERT_TRUE(r.has_value());
+    EXPECT_EQ(r->status_code, EVMC_PRECOMPILE_FAILURE);
+
+    std::filesystem::remove(path);
+}
+
+TEST(state_precompiles_cache, load_invalid)
+{
+    Cache cache{Cache::default_max_size};
+    EXPECT_FALSE(cache.load("nonexistent_precompiles_cache.bin"));
+    EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(state_precompiles_cache, load_truncated)
+{
+    const auto path =
+        (std::filesystem::temp_directory_path() / "evmone_precompiles_cache_truncated.bin")
+            .string();
+    const bytes output{0x11, 0x22};
+    {
+        Cache cache{Cache::default_max_size};
+        for (uint8_t i = 0; i < 10; ++i)
+            cache.insert(PrecompileId::sha256, bytes{i}, success_result(output));
+        ASSERT_TRUE(cache.save(path));
+    }
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+
+    // Nothing is loaded from the invalid file, so no entry points into the unmapped file.
+    Cache cache{Cache::default_max_size};
+    EXPECT_FALSE(cache.load(path));
+    EXPECT_EQ(cache.size(), 0);
+    for (uint8_t i = 0; i < 10; ++i)
+        EXPECT_FALSE(cache.find(PrecompileId::sha256, bytes{i}, 0).has_value());
+
+    std::filesystem::remove(path);
+}
+
+TEST(state_precompiles_cache, load_corrupted)
+{
+    const auto path =
+        (std::filesystem::temp_directory_path() / "evmone_precompiles_cache_corrupted.bin")
+            .string();
+    const bytes output{0x11, 0x22};
+    {
+        Cache cache{Cache::default_max_size};
+        for (uint8_t i = 0; i < 10; ++i)
+            cache.insert(PrecompileId::sha256, bytes{i}, success_result(output));
+        ASSERT_TRUE(cache.save(path));
+    }
+    {
+        // Change the last byte of an output: the layout of the file stays valid.
+        std::fstream file{path, std::ios::binary | std::ios::in | std::ios::out};
+        file.seekp(-1, std::ios::end);
+        file.put(0x33);
+    }
+
+    Cache cache{Cache::default_max_size};
+    EXPECT_FALSE(cache.load(path));
+    EXPECT_EQ(cache.size(), 0);
+
+    std::filesystem::remove(path);
+}
+
+TEST(state_precompiles_cache, concurrent_save)
+{
+    const auto dir = std::filesystem::temp_directory_path() / "evmone_precompiles_cache_save";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    const auto path = (dir / "cache.bin").string();
+
+    Cache cache{Cache::default_max_size};
+    const bytes output(32, 0x01);
+    for (uint8_t i = 0; i < 100; ++i)
+        cache.insert(PrecompileId::sha256, bytes{i}, success_result(output));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([&cache, &path] { EXPECT_TRUE(cache.save(path)); });
+    for (auto& t : threads)
+        t.join();
+
+    // Every save has written a whole file of its own: the last one renamed is valid.
+    Cache loaded{Cache::default_max_size};
+    ASSERT_TRUE(loaded.load(path));
+    EXPECT_EQ(loaded.size(), 100);
+    EXPECT_EQ(std::distance(std::filesystem::directory_iterator{dir},
+                  std::filesystem::directory_iterator{}),
+        1);
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST(state_precompiles_cache, concurrent_access)
+{
+    Cache cache{Cache::default_max_size};
+    const bytes output(32, 0x01);
+    std::vector<std::thread> threads;
+    for (uint8_t t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&cache, &output, t] {
+            for (uint8_t i = 0; i < 200; ++i)
+            {
+                const bytes input{t, i};
+                cache.insert(PrecompileId::sha256, input, success_result(output));
+                const auto r = cache.find(PrecompileId::sha256, input, 0);
+                EXPECT_TRUE(r.has_value());
+            }
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+    EXPECT_EQ(cache.size(), 4 * 200);
+}
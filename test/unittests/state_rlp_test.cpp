@@ -457,3 +457,105 @@ TEST(state_rlp, tx_to_rlp_eip2930_with_non_empty_access_list)
     EXPECT_EQ(keccak256(rlp::encode(tx)),
         0xf076e75aa935552e20e5d9fd4d1dda4ff33399ff3d6ac22843ae646f82c385d4_bytes32);
 }
+
+TEST(state_rlp, encoded_size)
+{
+    const std::vector<std::vector<uint256>> v{{}, {1, 0x80, 0xffff_u256 << 200}, {0}};
+    EXPECT_EQ(rlp::encoded_size(v), rlp::encode(v).size());
+    EXPECT_EQ(rlp::encoded_size(bytes(0xaabb, 0x01)), 0xaabb + 3);
+    EXPECT_EQ(rlp::encoded_size(uint64_t{0}), 1);
+    EXPECT_EQ(rlp::encoded_size(uint64_t{0x7f}), 1);
+    EXPECT_EQ(rlp::encoded_size(uint64_t{0x80}), 2);
+    EXPECT_EQ(rlp::encoded_size(uint64_t{0xffffffffffffffff}), 9);
+}
+
+TEST(state_rlp, encode_to)
+{
+    const CustomStruct t{1, {0x02, 0x03}};
+    uint8_t buf[16]{};
+    EXPECT_EQ(rlp::encode_to(buf, std::tuple{uint64_t{1}, t}), 7);
+    EXPECT_EQ(hex({buf, 8}), "c601c40182020300");
+}
+
+TEST(state_rlp, encode_raw)
+{
+    const auto inner = rlp::encode(uint64_t{0x80});
+    EXPECT_EQ(rlp::encode_tuple(rlp::Raw{inner}, bytes_view{}), "c3818080"_hex);
+}
+
+TEST(state_rlp, encode_typed)
+{
+    EXPECT_EQ(rlp::encode_typed(0x02, uint64_t{1}, bytes{}), "02c20180"_hex);
+}
+
+TEST(state_rlp, encode_withdrawal)
+{
+    const state::Withdrawal w{1, 2, 0x0000000000000000000000000000000000000003_address, 4};
+    EXPECT_EQ(rlp::encode(w), "d8 01 02 940000000000000000000000000000000000000003 04"_hex);
+    EXPECT_EQ(rlp::encoded_size(std::vector{w, w}), 2 * 25 + 1);
+}
+
+TEST(state_rlp, decode_string)
+{
+    const auto input = "83010203 05 80 b838"_hex + bytes(56, 0xaa);
+    bytes_view in{input};
+    EXPECT_EQ(rlp::decode_string(in), "010203"_hex);
+    EXPECT_EQ(rlp::decode_string(in), "05"_hex);
+    EXPECT_EQ(rlp::decode_string(in), bytes_view{});
+    const auto long_string = rlp::decode_string(in);
+    EXPECT_EQ(long_string, bytes(56, 0xaa));
+    EXPECT_EQ(long_string.data(), &input[input.size() - 56]);  // A view of the input.
+    EXPECT_TRUE(in.empty());
+}
+
+TEST(state_rlp, decode_roundtrip)
+{
+    const state::Withdrawal w{
+        0xffffffffffffffff, 0x80, 0x0102030405060708090a0b0c0d0e0f1011121314_address, 0};
+    const std::vector<uint256> values{0, 1, 0x80, 0xabcdef_u256 << 232};
+
+    const auto encoding = rlp::encode_tuple(w, values, "abc"_b);
+    bytes_view in{encoding};
+    state::Withdrawal w2;
+    std::vector<uint256> values2;
+    bytes_view str;
+    auto items = rlp::decode_list(in);
+    rlp::decode_tuple(items, w2.index, w2.validator_index, w2.recipient, w2.amount_in_gwei);
+    rlp::decode(items, values2);
+    rlp::decode(items, str);
+    EXPECT_TRUE(items.empty());
+    EXPECT_TRUE(in.empty());
+
+    EXPECT_EQ(w2.index, w.index);
+    EXPECT_EQ(w2.validator_index, w.validator_index);
+    EXPECT_EQ(w2.recipient, w.recipient);
+    EXPECT_EQ(w2.amount_in_gwei, w.amount_in_gwei);
+    EXPECT_EQ(values2, values);
+    EXPECT_EQ(str, "abc"_b);
+}
+
+TEST(state_rlp, decode_invalid)
+{
+    const auto decode_item = [](const bytes& input) {
+        bytes_view in{input};
+        return rlp::decode_item(in);
+    };
+    EXPECT_THROW(decode_item({}), std::invalid_argument);
+    EXPECT_THROW(decode_item("82 01"_hex), std::invalid_argument);                // Truncated.
+    EXPECT_THROW(decode_item("c2 01"_hex), std::invalid_argument);                // Truncated.
+    EXPECT_THROW(decode_item("81 05"_hex), std::invalid_argument);                // Single byte.
+    EXPECT_THROW(decode_item("b8 05 0102030405"_hex), std::invalid_argument);     // Short length.
+    EXPECT_THROW(decode_item("b9 0038"_hex + bytes(56, 0)), std::invalid_argument);  // Zero byte.
+
+    bytes_view in;
+    const auto leading_zero = "820001"_hex;
+    in = leading_zero;
+    uint64_t x = 0;
+    EXPECT_THROW(rlp::decode(in, x), std::invalid_argument);
+    const auto too_long = "89 010000000000000000"_hex;
+    in = too_long;
+    EXPECT_THROW(rlp::decode(in, x), std::invalid_argument);
+    const auto list = "c0"_hex;
+    in = list;
+    EXPECT_THROW(rlp::decode_string(in), std::invalid_argument);
+}